@@ -0,0 +1,367 @@
+/**
+ * @file
+ * Benchmarks of the library hot paths.
+ * Prints one line per measurement in CSV format:
+ * `benchmark,param,operations,ns_per_op`. The meaning of `param` depends on
+ * the benchmark: number of delegates for events, number of threads for the
+ * contended ones. Build and run with `make bench`.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "libsstl.h"
+
+namespace {
+
+/** Keeps results alive so the compiler can't remove the measured code. */
+volatile long g_sink = 0;
+
+/** Minimum time of each measurement, in nanoseconds. */
+double g_minTime = 2e8;
+
+typedef std::chrono::steady_clock clock_t_;
+
+// void report(const char *name, long param, size_t operations, double ns);/*{{{*/
+/**
+ * Prints a measurement.
+ **/
+void report(const char *name, long param, size_t operations, double ns) {
+    printf("%s,%ld,%zu,%.3f\n", name, param, operations, ns / (double)operations);
+    fflush(stdout);
+}
+/*}}}*/
+// void measure(const char *name, long param, _Body_t body, size_t ops = 1);/*{{{*/
+/**
+ * Runs \a body with growing iteration counts until it takes at least
+ * `g_minTime`, then reports the time per operation.
+ * @param body Callable receiving the number of iterations to run.
+ * @param ops Number of operations done in each iteration.
+ **/
+template <typename _Body_t>
+void measure(const char *name, long param, _Body_t body, size_t ops = 1) {
+    size_t iterations = 1;
+    for (;;) {
+        clock_t_::time_point start = clock_t_::now();
+        body(iterations);
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t_::now() - start).count();
+
+        if ((ns >= g_minTime) || (iterations >= ((size_t)1 << 40))) {
+            report(name, param, iterations * ops, ns);
+            return;
+        }
+        size_t next = (ns > 0.0) ? (size_t)((double)iterations * (g_minTime * 1.2) / ns) : iterations * 100;
+        iterations = (next > iterations * 100) ? iterations * 100 : ((next <= iterations) ? iterations * 2 : next);
+    }
+}
+/*}}}*/
+
+/* ------------------------------------------------------------------------ */
+/* Functor invocation                                                       */
+/* ------------------------------------------------------------------------ */
+struct Base {
+    virtual ~Base() { }
+    virtual int call(int value) = 0;
+};
+
+struct Adder : Base {
+    int total;
+    Adder() : total(0) { }
+    int add(int value) { return (total += value); }
+    int call(int value) { return (total += value); }
+};
+
+int freeAdd(int value) { return (int)(g_sink += value); }
+
+// void benchFunctors();/*{{{*/
+void benchFunctors() {
+    Adder adder;
+
+    ss::FunctorT<int (int)> member;
+    member.bind<Adder, &Adder::add>(&adder);
+    ss::FunctorT<int (int)> *volatile pmember = &member;
+    measure("functor_member", 0, [&](size_t n) {
+        ss::FunctorT<int (int)> &f = *pmember;
+        for (size_t i = 0; i < n; ++i) f((int)i);
+    });
+
+    ss::FunctorT<int (int)> function(&freeAdd);
+    ss::FunctorT<int (int)> *volatile pfunction = &function;
+    measure("functor_function", 0, [&](size_t n) {
+        ss::FunctorT<int (int)> &f = *pfunction;
+        for (size_t i = 0; i < n; ++i) f((int)i);
+    });
+
+    std::function<int (int)> stdmember = std::bind(&Adder::add, &adder, std::placeholders::_1);
+    std::function<int (int)> *volatile pstd = &stdmember;
+    measure("std_function_member", 0, [&](size_t n) {
+        std::function<int (int)> &f = *pstd;
+        for (size_t i = 0; i < n; ++i) f((int)i);
+    });
+
+    std::function<int (int)> stdlambda = [&adder](int value) { return adder.add(value); };
+    std::function<int (int)> *volatile plambda = &stdlambda;
+    measure("std_function_lambda", 0, [&](size_t n) {
+        std::function<int (int)> &f = *plambda;
+        for (size_t i = 0; i < n; ++i) f((int)i);
+    });
+
+    Base *volatile pbase = &adder;
+    measure("virtual_call", 0, [&](size_t n) {
+        Base *b = pbase;
+        for (size_t i = 0; i < n; ++i) b->call((int)i);
+    });
+
+    g_sink += adder.total;
+}
+/*}}}*/
+
+/* ------------------------------------------------------------------------ */
+/* Events                                                                   */
+/* ------------------------------------------------------------------------ */
+struct Listener {
+    long total;
+    Listener() : total(0) { }
+    void onEvent(int value) { total += value; }
+};
+
+// void benchTrigger();/*{{{*/
+void benchTrigger() {
+    static const long counts[] = { 1, 4, 64, 1024 };
+
+    for (size_t c = 0; c < (sizeof(counts) / sizeof(counts[0])); ++c) {
+        std::vector<Listener> listeners((size_t)counts[c]);
+        ss::EventT<void (int)> event;
+        for (size_t i = 0; i < listeners.size(); ++i)
+            event.bind<Listener, &Listener::onEvent>(&listeners[i]);
+
+        measure("event_trigger", counts[c], [&](size_t n) {
+            for (size_t i = 0; i < n; ++i) event.trigger((int)i);
+        });
+
+        std::vector<std::function<void (int)> > functions;
+        for (size_t i = 0; i < listeners.size(); ++i) {
+            Listener *l = &listeners[i];
+            functions.push_back([l](int value) { l->onEvent(value); });
+        }
+        measure("std_function_vector_trigger", counts[c], [&](size_t n) {
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = 0; j < functions.size(); ++j) functions[j]((int)i);
+        });
+
+        ss::ConcurrentEventT<void (int)> concurrent;
+        for (size_t i = 0; i < listeners.size(); ++i)
+            concurrent.bind<Listener, &Listener::onEvent>(&listeners[i]);
+        measure("concurrent_event_trigger", counts[c], [&](size_t n) {
+            for (size_t i = 0; i < n; ++i) concurrent.trigger((int)i);
+        });
+
+        for (size_t i = 0; i < listeners.size(); ++i) g_sink += listeners[i].total;
+    }
+}
+/*}}}*/
+// void benchAddRemove();/*{{{*/
+void benchAddRemove() {
+    static const long counts[] = { 16, 256, 4096 };
+
+    for (size_t c = 0; c < (sizeof(counts) / sizeof(counts[0])); ++c) {
+        std::vector<Listener> listeners((size_t)counts[c]);
+
+        for (int indexed = 0; indexed < 2; ++indexed) {
+            /* Reported time is per add plus remove pair. */
+            measure(indexed ? "event_add_remove_indexed" : "event_add_remove", counts[c], [&](size_t n) {
+                for (size_t r = 0; r < n; ++r) {
+                    ss::EventT<void (int)> event;
+                    event.indexed(indexed != 0);
+                    for (size_t i = 0; i < listeners.size(); ++i)
+                        event.add<Listener, &Listener::onEvent>(&listeners[i]);
+                    for (size_t i = 0; i < listeners.size(); ++i)
+                        event.remove<Listener, &Listener::onEvent>(&listeners[i]);
+                    g_sink += (long)event.count();
+                }
+            }, listeners.size());
+        }
+    }
+}
+/*}}}*/
+
+/* ------------------------------------------------------------------------ */
+/* Shared pointers                                                          */
+/* ------------------------------------------------------------------------ */
+struct Payload {
+    long value;
+    explicit Payload(long v = 0) : value(v) { }
+};
+
+// void benchShared();/*{{{*/
+void benchShared() {
+    ss::SharedT<Payload> shared(new Payload(1));
+    measure("shared_copy_destroy", 1, [&](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            ss::SharedT<Payload> copy(shared);
+            g_sink += copy->value;
+        }
+    });
+
+    ss::SharedT<Payload, ss::SingleThread> single(new Payload(1));
+    measure("shared_copy_destroy_single_thread", 1, [&](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            ss::SharedT<Payload, ss::SingleThread> copy(single);
+            g_sink += copy->value;
+        }
+    });
+
+    measure("shared_new", 1, [&](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            ss::SharedT<Payload> p(new Payload((long)i));
+            g_sink += p->value;
+        }
+    });
+
+    measure("make_shared", 1, [&](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            ss::SharedT<Payload> p = ss::makeShared<Payload>((long)i);
+            g_sink += p->value;
+        }
+    });
+
+    unsigned hw = std::thread::hardware_concurrency();
+    long threads = (hw > 1) ? (long)((hw < 8) ? hw : 8) : 2;
+    measure("shared_copy_destroy_contended", threads, [&](size_t n) {
+        std::vector<std::thread> pool;
+        std::vector<long> sums(threads, 0);     /* Summed after join(). */
+        for (long t = 0; t < threads; ++t) {
+            pool.push_back(std::thread([&shared, &sums, t, n]() {
+                long local = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    ss::SharedT<Payload> copy(shared);
+                    local += copy->value;
+                }
+                sums[t] = local;
+            }));
+        }
+        for (size_t t = 0; t < pool.size(); ++t) pool[t].join();
+        for (size_t t = 0; t < sums.size(); ++t) g_sink += sums[t];
+    });
+
+    ss::AtomicSharedT<Payload> slot(shared);
+    measure("atomic_shared_load_contended", threads, [&](size_t n) {
+        std::vector<std::thread> pool;
+        std::vector<long> sums(threads, 0);     /* Summed after join(). */
+        for (long t = 0; t < threads; ++t) {
+            pool.push_back(std::thread([&slot, &sums, t, n]() {
+                long local = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    ss::SharedT<Payload> copy = slot.load();
+                    local += copy->value;
+                }
+                sums[t] = local;
+            }));
+        }
+        for (size_t t = 0; t < pool.size(); ++t) pool[t].join();
+        for (size_t t = 0; t < sums.size(); ++t) g_sink += sums[t];
+    });
+}
+/*}}}*/
+
+/* ------------------------------------------------------------------------ */
+/* Properties                                                               */
+/* ------------------------------------------------------------------------ */
+class Model
+{
+public:
+    ss::PropertyT<int> number;
+    rw::PropertyT<std::string, const std::string&> text;
+    ro::PropertyT<int> readOnly;
+
+    Model() : m_number(0), m_text("some text that does not fit in SSO") {
+        ssplink(number, this, Model, getNumber, setNumber);
+        ssplink(text, this, Model, getText, setText);
+        readOnly.bind<Model, &Model::getNumber>(this);
+    }
+
+    int getNumber() const { return m_number; }
+    void setNumber(int value) { m_number = value; }
+    std::string getText() const { return m_text; }
+    void setText(const std::string &value) { m_text = value; }
+
+private:
+    int m_number;
+    std::string m_text;
+};
+
+// void benchProperties();/*{{{*/
+void benchProperties() {
+    Model model;
+    Model *volatile pmodel = &model;
+
+    measure("direct_get", 0, [&](size_t n) {
+        Model *m = pmodel;
+        for (size_t i = 0; i < n; ++i) g_sink += m->getNumber();
+    });
+    measure("ss_property_get", 0, [&](size_t n) {
+        Model *m = pmodel;
+        for (size_t i = 0; i < n; ++i) g_sink += m->number.get();
+    });
+    measure("ss_property_set", 0, [&](size_t n) {
+        Model *m = pmodel;
+        for (size_t i = 0; i < n; ++i) m->number.set((int)i);
+    });
+    measure("ss_property_add_assign", 0, [&](size_t n) {
+        Model *m = pmodel;
+        for (size_t i = 0; i < n; ++i) m->number += 1;
+    });
+    measure("ro_property_get", 0, [&](size_t n) {
+        Model *m = pmodel;
+        for (size_t i = 0; i < n; ++i) g_sink += m->readOnly.get();
+    });
+    measure("rw_property_get", 0, [&](size_t n) {
+        Model *m = pmodel;
+        for (size_t i = 0; i < n; ++i) g_sink += (long)m->text.get().size();
+    });
+    std::string value("another text that does not fit in SSO");
+    measure("rw_property_set", 0, [&](size_t n) {
+        Model *m = pmodel;
+        for (size_t i = 0; i < n; ++i) m->text.set(value);
+    });
+}
+/*}}}*/
+
+}   /* namespace */
+
+// int main(int argc, char **argv);/*{{{*/
+/**
+ * Runs the benchmarks.
+ * Accepts an optional argument with the name of a group to run: functors,
+ * trigger, addremove, shared or properties. `-t <ms>` changes the minimum
+ * time of each measurement.
+ **/
+int main(int argc, char **argv) {
+    const char *group = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        if ((strcmp(argv[i], "-t") == 0) && ((i + 1) < argc))
+            g_minTime = atof(argv[++i]) * 1e6;
+        else
+            group = argv[i];
+    }
+
+    printf("benchmark,param,operations,ns_per_op\n");
+    if (!group || (strcmp(group, "functors") == 0))   benchFunctors();
+    if (!group || (strcmp(group, "trigger") == 0))    benchTrigger();
+    if (!group || (strcmp(group, "addremove") == 0))  benchAddRemove();
+    if (!group || (strcmp(group, "shared") == 0))     benchShared();
+    if (!group || (strcmp(group, "properties") == 0)) benchProperties();
+    return 0;
+}
+/*}}}*/
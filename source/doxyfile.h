@@ -31,11 +31,11 @@
  * `operator ()`. A class instance is created then it is used like a function
  * call. Functors in this library are template classes that call bound pointer
  * to member functions when its `operator ()` is invoked. The implementation
- * in this library is simple and doesn't support functions with more than one
- * parameter. We made this way becouse we are still using C++98 and cannot
- * change to C++11 yet. So functors need to compile in old compilers. The
- * current implementation doesn't have the same power as `std::function`
- * template but are usable for most of your needs.
+ * is a single variadic template that supports functions with any number of
+ * parameters. Arguments are perfectly forwarded down to the called function,
+ * so they are not copied at every call level. This requires a C++11
+ * compiler. The current implementation doesn't have the same power as
+ * `std::function` template but are usable for most of your needs.
  * @since 1.0
  **/
 
@@ -45,8 +45,7 @@
  * This group have property like class templates. C++ has no directy support
  * for properties in classes or objects, unfotunatelly. This is a common path
  * on most used languages but not on C++. We built a set of class templates to
- * mimic this funcionality. The implementation is totally C++ compliant and
- * can be used with compilers that doesn't support C++11 yet.
+ * mimic this funcionality. The implementation is totally C++ compliant.
  *
  * To use the templates you must declare a member in your class, choosing the
  * right template to use, and write getters (and setters, if applicable) to
@@ -131,6 +130,42 @@
  * assures that the property value will be passed to the `printf()` function.
  * If we didn't have used it, the `printf()` function would received a pointer
  * to the property object it self.
+ *
+ * `ss::PropertyT` passes values that are not small and trivially copyable by
+ * const reference, can move rvalues into the setter and, when a reference
+ * accessor is bound with `access()`, its `modify()` function and compound
+ * assignment operators change the value in place.
+ *
+ * When other objects need to know about changes in a property value use
+ * `ss::ObservableT`, declared in `sstlobsv.hpp`. It is bound in the same way
+ * but triggers its `changed` event, with the old and the new value, only when
+ * the value really changes. Inside a `ss::PropertyBatch` scope, declared in
+ * `sstlbatc.hpp`, these notifications are merged and delivered once when the
+ * scope ends.
+ *
+ * Read only values that are expensive to compute can use `ro::CachedT`,
+ * declared in `sstlcach.hpp`. It calls the getter once and keeps the result
+ * until the cache is invalidated, directly or by a linked event.
+ *
+ * Values defined by expressions over other values, like spreadsheet cells,
+ * are declared in `sstlcomp.hpp`. `ss::CellT` holds a source value and
+ * `ss::ComputedT` is defined by an expression, like `total = price * qty`,
+ * that is recomputed only when the cells it depends on change.
+ *
+ * The properties of a class can be listed at compile time with
+ * `ss::reflect()` and the `ssfield()` macro, declared in `sstlrefl.hpp`. The
+ * resulting table enumerates the properties and copies all of them, for many
+ * objects at once, to and from flat records.
+ *
+ * Values shared between threads can use `ss::AtomicPropertyT`, declared in
+ * `sstlatpr.hpp`. It keeps the value in a `std::atomic` and maps compound
+ * operators to single atomic operations.
+ *
+ * `sstlprop.hpp` includes every property class. Each one is also declared in
+ * its own header: `sstlprss.hpp`, `sstlprrw.hpp` and `sstlprro.hpp`. When
+ * the `SSTL_EXTERN_TEMPLATES` macro is defined the instances for `int`,
+ * `bool`, `double` and `std::string` values are declared `extern` and
+ * compiled once in the library built by `make lib`.
  * @since 1.0
  **/
 
@@ -143,6 +178,12 @@
  * behavior is not intended to be used to represent existing types. In our
  * opinion properties really should be a sintax-sugar in the language and not
  * a class/template construction.
+ *
+ * A single set of operator templates, declared in `sstlprtr.hpp`, serves any
+ * combination of `ss::PropertyT`, `rw::PropertyT` and `ro::PropertyT`
+ * objects. The operators are enabled only when both operands are properties,
+ * identified by `sstl::PropertyTraitsT`. Comparisons with plain values remain
+ * member operators of each property class.
  * @since 1.0
  * @ingroup sstl_properties
  **/
@@ -199,26 +240,76 @@
  * };
  ~~~~~~~~~~~~~~~~~~~~~
  * Notice that events are not thread safe and cannot be used to cross thread
- * communication. Also, objects bound to functors bound to events must remain
+ * communication. When an event must be triggered and changed from different
+ * threads use `ss::ConcurrentEventT`, declared in `sstlconc.hpp`. Also, objects bound to functors bound to events must remain
  * valid white the event is valid. You must remove the bound delegate from the
  * event list when an object is destroyed before the event it self.
+ *
+ * Subscribers can use `ss::EventT::connect()` instead of `bind()`. It
+ * returns an `ss::Connection` handle that removes the delegate without
+ * searching the list. Keeping the handle in an `ss::ScopedConnection` member
+ * removes the delegate automatically when the subscriber is destroyed.
+ *
+ * With a C++20 compiler a coroutine can wait for an event with
+ * `co_await event.next()`. Nothing is allocated to suspend it. It is
+ * resumed by `trigger()`, after the delegates, or through a scheduler given
+ * to `next()`.
+ *
+ * When all subscribers are known at compile time use `ss::StaticEventT`,
+ * declared in `sstlstev.hpp`. Its member functions are template parameters
+ * and its trigger is a sequence of direct calls that can be inlined.
+ *
+ * When delegates return values, `ss::EventT::combine()` triggers the event
+ * passing each result to a combiner, like `ss::FirstTrue`, that stops at the
+ * first delegate that handles the event, or `ss::SumT`, `ss::MinT`,
+ * `ss::MaxT` and `ss::CollectT`.
+ *
+ * Events can be instrumented to find the ones triggered more often and the
+ * slow delegates. When the `SSTL_INSTRUMENT` macro is defined an event given
+ * an `ss::EventStats` object, through `ss::EventT::instrument()`, counts its
+ * triggers and keeps latency histograms of its delegates. All counters can
+ * be listed with `ss::StatsRegistry`, declared in `sstlinst.hpp`. Without the
+ * macro there is no instrumentation code at all.
  * @since 1.0
  **/
 
 /**
  * @defgroup sstl_shared Shared Pointer
  * Group por simplified shared pointer template classes.
- * Currently this group has only one template class: the `ss::SharedT`. It is
+ * The main template class of this group is the `ss::SharedT`. It is
  * able to share a single pointer among multiple references managing the life
  * time of that pointer until the last reference is released. Since it is
  * a typed pointer any object (class or structure) can be held and kept.
  * Although it will work with pointers of `std::list` or `std::vector` it will
  * not work with arrays of scalar types (`int[]`, `char[]`, etc...).
  *
- * Since this is a simplified version it will never allocate memory for the
- * underlining object. You must do that. Also, there is no automatic
+ * The underlining object can be allocated by you or by `ss::makeShared()`,
+ * which builds the object and the reference counter in a single memory
+ * block. Also, there is no automatic
  * conversion of pointers to `ss::SharedT` class. The constructor that accepts
  * the pointer to the object to be shared is \e explicit.
+ *
+ * The reference counter is atomic by default so copies of the same pointer
+ * can be created and released in different threads. Pointers that never
+ * leave a thread can use the `ss::SingleThread` policy to avoid atomic
+ * instructions.
+ *
+ * Objects can be observed without being kept alive through `ss::WeakT`. It
+ * shares the control block of `ss::SharedT` and its `lock()` operation
+ * returns an empty shared pointer after the object is deleted.
+ *
+ * Objects that embed their own reference counter, like the ones derived from
+ * `ss::RefCountedT`, can be shared with `ss::IntrusiveT`, declared in
+ * `sstlintr.hpp`. It has the same interface as `ss::SharedT` but doesn't
+ * allocate a control block.
+ *
+ * A shared pointer that is read and replaced by several threads at the same
+ * time can be kept in an `ss::AtomicSharedT`, declared in `sstlatom.hpp`.
+ * Its `load()`, `store()` and `exchange()` operations are lock free.
+ *
+ * When the `SSTL_INSTRUMENT` macro is defined the number of live objects of
+ * each type held by `ss::SharedT`, and its peak, is kept in an
+ * `ss::SharedStats` object listed by `ss::StatsRegistry`.
  * @since 1.0
  **/
 
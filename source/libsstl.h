@@ -11,9 +11,22 @@
 #ifndef __LIBSSTL_H_DEFINED__
 #define __LIBSSTL_H_DEFINED__
 
+#include "sstlinst.hpp"
 #include "sstlshrp.hpp"
+#include "sstlintr.hpp"
+#include "sstlatom.hpp"
 #include "sstlfunc.hpp"
 #include "sstlprop.hpp"
+#include "sstlbatc.hpp"
+#include "sstlobsv.hpp"
+#include "sstlcach.hpp"
+#include "sstlcomp.hpp"
+#include "sstlrefl.hpp"
+#include "sstlatpr.hpp"
 #include "sstleven.hpp"
+#include "sstlstev.hpp"
+#include "sstlconc.hpp"
+#include "sstlqueu.hpp"
+#include "sstlpool.hpp"
 
 #endif /* __LIBSSTL_H_DEFINED__ */
@@ -0,0 +1,261 @@
+/**
+ * @file
+ * Declares the ss::AtomicSharedT class template.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLATOM_HPP_DEFINED__
+#define __SSTLATOM_HPP_DEFINED__
+
+#include <cstdint>
+#include <atomic>
+#include <utility>
+#include "sstlshrp.hpp"
+
+namespace ss {
+
+/**
+ * Atomic slot holding a shared pointer.
+ * Allows a `ss::SharedT` to be read and replaced from different threads at
+ * the same time without locks. It is intended to publish read mostly data,
+ * like configurations, read by lots of threads and replaced from time to
+ * time.
+ *
+ * The implementation reserves references in batches. When a pointer is
+ * stored a batch of references is added to its control block. The slot
+ * keeps, in a single atomic word, the control block pointer and the number
+ * of reserved references already taken. A reader takes one with a single
+ * increment of that word and never gives anything back to the slot, so a
+ * pointer that is replaced and stored again can't be confused with its
+ * previous installation. The reader that finds half of the batch taken adds
+ * more references to the block. A writer that replaces the pointer releases
+ * the references not taken. All operations are lock free when
+ * `std::atomic<uint64_t>` is.
+ * @tparam _Class_t The pointer type. The shared pointers must use the
+ * `ss::MultiThread` policy.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * ss::AtomicSharedT<Config> current(ss::makeShared<Config>());
+ *
+ * // Any reader thread:
+ * ss::SharedT<Config> config = current.load();
+ *
+ * // Writer thread:
+ * current.store(ss::makeShared<Config>(newValues));
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @note On 64 bits platforms the control block address must fit in 48
+ * bits, which is true for user space addresses on x86-64 and AArch64. Up to
+ * 16384 readers can be inside `load()` at the same time. While a pointer is
+ * held by the slot, `ss::SharedT::shares()` also counts the references
+ * reserved by the slot.
+ * @since 1.2
+ * @ingroup sstl_shared
+ *//* --------------------------------------------------------------------- */
+template <class _Class_t>
+class AtomicSharedT
+{
+public:
+    // Data Types
+    typedef _Class_t class_t;                           /**< The class type. */
+    typedef SharedT<_Class_t, MultiThread> shared_t;    /**< Pointer type.   */
+
+    /** @name Constructors & Destructor */ //@{
+    // AtomicSharedT();/*{{{*/
+    /**
+     * Default constructor.
+     * Builds an empty slot.
+     * @since 1.2
+     **/
+    AtomicSharedT() noexcept : m_value(0) { }
+    /*}}}*/
+    // explicit AtomicSharedT(shared_t value);/*{{{*/
+    /**
+     * Builds a slot holding a shared pointer.
+     * @param value The initial value.
+     * @since 1.2
+     **/
+    explicit AtomicSharedT(shared_t value) noexcept : m_value(take(value)) { }
+    /*}}}*/
+    // ~AtomicSharedT();/*{{{*/
+    /**
+     * Destructor.
+     * Releases the held pointer. No thread can be using the slot.
+     * @since 1.2
+     **/
+    ~AtomicSharedT() {
+        exchange(shared_t());
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // bool lockFree() const;/*{{{*/
+    /**
+     * Checks whether the operations of this slot are lock free.
+     * @since 1.2
+     **/
+    bool lockFree() const noexcept {
+        return m_value.is_lock_free();
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // shared_t load() const;/*{{{*/
+    /**
+     * Reads the held pointer.
+     * @return A shared pointer with the current value. It is kept valid
+     * even if the slot is changed after this function returns.
+     * @since 1.2
+     **/
+    shared_t load() const noexcept {
+        if (!blockOf(m_value.load(std::memory_order_relaxed)))
+            return shared_t();
+
+        uint64_t value = m_value.fetch_add(borrow(), std::memory_order_acquire);
+        pointer_t *block = blockOf(value);
+        if (!block) {
+            giveBack();
+            return shared_t();
+        }
+        if (takenOf(value) >= refill()) reserve(block);
+        return shared_t(block->data, block);    /* A reserved reference. */
+    }
+    /*}}}*/
+    // void store(shared_t value);/*{{{*/
+    /**
+     * Replaces the held pointer.
+     * @param value The new value. The previous one is released.
+     * @since 1.2
+     **/
+    void store(shared_t value) noexcept {
+        exchange(std::move(value));
+    }
+    /*}}}*/
+    // shared_t exchange(shared_t value);/*{{{*/
+    /**
+     * Replaces the held pointer returning the previous one.
+     * @param value The new value.
+     * @return The previous value.
+     * @since 1.2
+     **/
+    shared_t exchange(shared_t value) noexcept {
+        uint64_t old = m_value.exchange(take(value), std::memory_order_acq_rel);
+        pointer_t *block = blockOf(old);
+        if (!block) return shared_t();
+
+        /* Never reaches zero: the reference of the slot is kept. */
+        intptr_t unused = batch() - (intptr_t)takenOf(old);
+        block->refs.fetch_sub(unused, std::memory_order_acq_rel);
+        return shared_t(block->data, block);    /* Reference of the slot. */
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // operator shared_t() const;/*{{{*/
+    /**
+     * Same as `load()`.
+     * @since 1.2
+     **/
+    operator shared_t() const noexcept {
+        return load();
+    }
+    /*}}}*/
+    // AtomicSharedT& operator =(shared_t value);/*{{{*/
+    /**
+     * Same as `store()`.
+     * @return A reference to \b this instance.
+     * @since 1.2
+     **/
+    AtomicSharedT& operator =(shared_t value) noexcept {
+        store(std::move(value));
+        return *this;
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** Type of the control block. */
+    typedef typename shared_t::pointer_t pointer_t;
+
+    /** @name Implementation */ //@{
+    /** Number of bits of the slot word used by the block address. */
+    static unsigned shift() { return (sizeof(void *) >= 8 ? 48 : 32); }
+    /** One taken reference in the slot word. */
+    static uint64_t borrow() { return ((uint64_t)1 << shift()); }
+    /** References reserved when a pointer is stored. */
+    static intptr_t batch() { return ((intptr_t)1 << 15); }
+    /** Taken references that make a reader reserve more. */
+    static uint64_t refill() { return (uint64_t)(batch() / 2); }
+    /** Extracts the block address of a slot word. */
+    static pointer_t* blockOf(uint64_t value) {
+        return reinterpret_cast<pointer_t *>((uintptr_t)(value & (borrow() - 1)));
+    }
+    /** Extracts the number of taken references of a slot word. */
+    static uint64_t takenOf(uint64_t value) { return (value >> shift()); }
+    /** Takes the block of a shared pointer, leaving it empty. */
+    static uint64_t take(shared_t &value) {
+        pointer_t *block = value.m_pointer;
+        value.m_pointer = NULL;
+        value.m_data    = NULL;
+        if (block) block->refs.fetch_add(batch(), std::memory_order_relaxed);
+        return (uint64_t)reinterpret_cast<uintptr_t>(block);
+    }
+    // void reserve(pointer_t *block) const;/*{{{*/
+    /**
+     * Reserves more references for readers.
+     * Called by a reader holding a reference to \a block. The references
+     * are added first and the taken count is decreased only if \a block is
+     * still in the slot. Any installation of it works: the references are
+     * added to the same block.
+     * @since 1.2
+     **/
+    void reserve(pointer_t *block) const noexcept {
+        uint64_t count = refill();
+        block->refs.fetch_add((intptr_t)count, std::memory_order_relaxed);
+
+        uint64_t expected = m_value.load(std::memory_order_relaxed);
+        while ((blockOf(expected) == block) && (takenOf(expected) >= count)) {
+            if (m_value.compare_exchange_weak(expected, expected - (count * borrow()),
+                    std::memory_order_release, std::memory_order_relaxed))
+                return;
+        }
+        /* Another reader did it, or the block left the slot. This thread
+         * still holds a reference, so the count doesn't reach zero. */
+        block->refs.fetch_sub((intptr_t)count, std::memory_order_relaxed);
+    }
+    /*}}}*/
+    // void giveBack() const;/*{{{*/
+    /**
+     * Undoes the increment of a reader that found the slot empty.
+     * Stops when a pointer is stored: the word was replaced with its count.
+     * @since 1.2
+     **/
+    void giveBack() const noexcept {
+        uint64_t expected = m_value.load(std::memory_order_relaxed);
+        while (!blockOf(expected) && takenOf(expected)) {
+            if (m_value.compare_exchange_weak(expected, expected - borrow(),
+                    std::memory_order_relaxed, std::memory_order_relaxed))
+                return;
+        }
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Disabled Operations */ //@{
+    AtomicSharedT(const AtomicSharedT &) = delete;
+    AtomicSharedT& operator =(const AtomicSharedT &) = delete;
+    //@}
+
+    // Data Members
+    mutable std::atomic<uint64_t> m_value;  /**< Block address and taken refs. */
+};
+
+}   /* namespace ss */
+
+#endif /* __SSTLATOM_HPP_DEFINED__ */
@@ -0,0 +1,313 @@
+/**
+ * @file
+ * Declares the ss::AtomicPropertyT class template.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLATPR_HPP_DEFINED__
+#define __SSTLATPR_HPP_DEFINED__
+
+#include <atomic>
+#include <type_traits>
+
+namespace ss {
+/**
+ * Property with an atomic value.
+ * Different of `ss::PropertyT` the value is kept inside this object, in a
+ * `std::atomic`, and there are no getter or setter functions. It can be read
+ * and written from different threads without locks. Useful for counters,
+ * statistics and state flags written by worker threads and read by
+ * monitoring threads.
+ *
+ * Compound operators are single atomic operations: `+=`, `-=`, `++` and
+ * `--` map to `fetch_add()` and `fetch_sub()`, `|=`, `&=` and `^=` map to
+ * `fetch_or()`, `fetch_and()` and `fetch_xor()`. For floating point values
+ * the arithmetic operators use a compare and exchange loop.
+ * @tparam _Value_t The type of the value. Must be trivially copyable.
+ * @tparam _Order Memory order of the operations. Defaults to
+ * `std::memory_order_seq_cst`. Loads and stores use the closest order valid
+ * to them: with `std::memory_order_acq_rel` loads are acquire and stores
+ * are release.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * struct Stats {
+ *     ss::AtomicPropertyT<long, std::memory_order_relaxed> processed;
+ *     ss::AtomicPropertyT<bool> running;
+ * };
+ *
+ * // Worker threads:
+ * ++stats.processed;
+ *
+ * // Monitoring thread:
+ * printf("%ld\n", stats.processed());
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t, std::memory_order _Order = std::memory_order_seq_cst>
+class AtomicPropertyT
+{
+public:
+    /** @name Constructor */ //@{
+    // AtomicPropertyT(_Value_t value = _Value_t());/*{{{*/
+    /**
+     * Builds the property.
+     * @param value Initial value.
+     * @since 1.2
+     **/
+    AtomicPropertyT(_Value_t value = _Value_t()) : m_value(value) { }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // bool lockFree() const;/*{{{*/
+    /**
+     * Checks whether the operations on the value are lock free.
+     * @since 1.2
+     **/
+    bool lockFree() const { return m_value.is_lock_free(); }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // _Value_t get() const;/*{{{*/
+    /**
+     * Reads the value.
+     * @since 1.2
+     **/
+    _Value_t get() const { return m_value.load(loadOrder()); }
+    /*}}}*/
+    // void set(_Value_t value);/*{{{*/
+    /**
+     * Writes the value.
+     * @since 1.2
+     **/
+    void set(_Value_t value) { m_value.store(value, storeOrder()); }
+    /*}}}*/
+    // _Value_t exchange(_Value_t value);/*{{{*/
+    /**
+     * Writes the value returning the previous one.
+     * @since 1.2
+     **/
+    _Value_t exchange(_Value_t value) { return m_value.exchange(value, _Order); }
+    /*}}}*/
+    // bool compareExchange(_Value_t &expected, _Value_t value);/*{{{*/
+    /**
+     * Writes the value when it is equal to an expected value.
+     * @param expected The expected value. Receives the current value when
+     * the operation fails.
+     * @param value The value to write.
+     * @return \b true when the value was written.
+     * @since 1.2
+     **/
+    bool compareExchange(_Value_t &expected, _Value_t value) {
+        return m_value.compare_exchange_strong(expected, value, _Order, loadOrder());
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // operator _Value_t() const;/*{{{*/
+    /**
+     * Cast to type operator.
+     * This operator calls #get().
+     * @since 1.2
+     **/
+    operator _Value_t() const { return get(); }
+    /*}}}*/
+    // _Value_t operator ()() const;/*{{{*/
+    /**
+     * Functor operator.
+     * Calls the #get() function.
+     * @since 1.2
+     **/
+    _Value_t operator ()() const { return get(); }
+    /*}}}*/
+    // _Value_t operator =(_Value_t value);/*{{{*/
+    /**
+     * Assignment operator.
+     * This operator calls #set().
+     * @return The value written.
+     * @since 1.2
+     **/
+    _Value_t operator =(_Value_t value) {
+        set(value); return value;
+    }
+    /*}}}*/
+    // _Value_t operator +=(_Value_t value);/*{{{*/
+    /**
+     * Addition operator.
+     * @return The value resulting of the operation.
+     * @since 1.2
+     **/
+    _Value_t operator +=(_Value_t value) {
+        return (add(value, arithmetic_t()) + value);
+    }
+    /*}}}*/
+    // _Value_t operator -=(_Value_t value);/*{{{*/
+    /**
+     * Subtraction operator.
+     * @return The value resulting of the operation.
+     * @since 1.2
+     **/
+    _Value_t operator -=(_Value_t value) {
+        return (sub(value, arithmetic_t()) - value);
+    }
+    /*}}}*/
+    // _Value_t operator ++();/*{{{*/
+    /**
+     * Prefix increment operator.
+     * @return The incremented value.
+     * @since 1.2
+     **/
+    _Value_t operator ++() { return (add(_Value_t(1), arithmetic_t()) + _Value_t(1)); }
+    /*}}}*/
+    // _Value_t operator ++(int);/*{{{*/
+    /**
+     * Postfix increment operator.
+     * @return The value before the increment.
+     * @since 1.2
+     **/
+    _Value_t operator ++(int) { return add(_Value_t(1), arithmetic_t()); }
+    /*}}}*/
+    // _Value_t operator --();/*{{{*/
+    /**
+     * Prefix decrement operator.
+     * @return The decremented value.
+     * @since 1.2
+     **/
+    _Value_t operator --() { return (sub(_Value_t(1), arithmetic_t()) - _Value_t(1)); }
+    /*}}}*/
+    // _Value_t operator --(int);/*{{{*/
+    /**
+     * Postfix decrement operator.
+     * @return The value before the decrement.
+     * @since 1.2
+     **/
+    _Value_t operator --(int) { return sub(_Value_t(1), arithmetic_t()); }
+    /*}}}*/
+    // _Value_t operator |=(_Value_t value);/*{{{*/
+    /**
+     * Bitwise "OR" operator.
+     * Available for integral types.
+     * @return The value resulting of the operation.
+     * @since 1.2
+     **/
+    _Value_t operator |=(_Value_t value) {
+        return (m_value.fetch_or(value, _Order) | value);
+    }
+    /*}}}*/
+    // _Value_t operator &=(_Value_t value);/*{{{*/
+    /**
+     * Bitwise "AND" operator.
+     * Available for integral types.
+     * @return The value resulting of the operation.
+     * @since 1.2
+     **/
+    _Value_t operator &=(_Value_t value) {
+        return (m_value.fetch_and(value, _Order) & value);
+    }
+    /*}}}*/
+    // _Value_t operator ^=(_Value_t value);/*{{{*/
+    /**
+     * Bitwise "XOR" operator.
+     * Available for integral types.
+     * @return The value resulting of the operation.
+     * @since 1.2
+     **/
+    _Value_t operator ^=(_Value_t value) {
+        return (m_value.fetch_xor(value, _Order) ^ value);
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** Selects `fetch_add()` (true) or a compare and exchange loop. */
+    typedef std::integral_constant<bool, std::is_integral<_Value_t>::value> arithmetic_t;
+
+    /** @name Implementation */ //@{
+    // static constexpr std::memory_order loadOrder();/*{{{*/
+    /**
+     * Memory order for loads.
+     * @since 1.2
+     **/
+    static constexpr std::memory_order loadOrder() {
+        return (_Order == std::memory_order_release) ? std::memory_order_relaxed :
+               (_Order == std::memory_order_acq_rel) ? std::memory_order_acquire : _Order;
+    }
+    /*}}}*/
+    // static constexpr std::memory_order storeOrder();/*{{{*/
+    /**
+     * Memory order for stores.
+     * @since 1.2
+     **/
+    static constexpr std::memory_order storeOrder() {
+        return ((_Order == std::memory_order_acquire) || (_Order == std::memory_order_consume)) ?
+               std::memory_order_relaxed :
+               (_Order == std::memory_order_acq_rel) ? std::memory_order_release : _Order;
+    }
+    /*}}}*/
+    // _Value_t add(_Value_t value, std::true_type);/*{{{*/
+    /**
+     * Adds to the value with `fetch_add()`.
+     * @return The previous value.
+     * @since 1.2
+     **/
+    _Value_t add(_Value_t value, std::true_type) {
+        return m_value.fetch_add(value, _Order);
+    }
+    /*}}}*/
+    // _Value_t add(_Value_t value, std::false_type);/*{{{*/
+    /**
+     * Adds to the value with a compare and exchange loop.
+     * @return The previous value.
+     * @since 1.2
+     **/
+    _Value_t add(_Value_t value, std::false_type) {
+        _Value_t current = m_value.load(std::memory_order_relaxed);
+        while (!m_value.compare_exchange_weak(current, current + value, _Order, loadOrder()))
+            ;
+        return current;
+    }
+    /*}}}*/
+    // _Value_t sub(_Value_t value, std::true_type);/*{{{*/
+    /**
+     * Subtracts from the value with `fetch_sub()`.
+     * @return The previous value.
+     * @since 1.2
+     **/
+    _Value_t sub(_Value_t value, std::true_type) {
+        return m_value.fetch_sub(value, _Order);
+    }
+    /*}}}*/
+    // _Value_t sub(_Value_t value, std::false_type);/*{{{*/
+    /**
+     * Subtracts from the value with a compare and exchange loop.
+     * @return The previous value.
+     * @since 1.2
+     **/
+    _Value_t sub(_Value_t value, std::false_type) {
+        _Value_t current = m_value.load(std::memory_order_relaxed);
+        while (!m_value.compare_exchange_weak(current, current - value, _Order, loadOrder()))
+            ;
+        return current;
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Disabled Operations */ //@{
+    AtomicPropertyT(const AtomicPropertyT &) = delete;
+    AtomicPropertyT& operator =(const AtomicPropertyT &) = delete;
+    //@}
+
+    // Data Members
+    std::atomic<_Value_t> m_value;      /**< The value. */
+};
+
+}   /* namespace ss */
+
+#endif /* __SSTLATPR_HPP_DEFINED__ */
@@ -0,0 +1,267 @@
+/**
+ * @file
+ * Declares the ss::PropertyBatch class.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLBATC_HPP_DEFINED__
+#define __SSTLBATC_HPP_DEFINED__
+
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "sstleven.hpp"
+
+namespace ss {
+/**
+ * Scope that groups change notifications.
+ * While an object of this class exists in a thread the `changed` event of
+ * every `ss::ObservableT` changed in that thread is held back. Events
+ * triggered through `PropertyBatch::trigger()` are also held back. When the
+ * scope ends each property that really changed notifies once, from the
+ * value it had before the scope to the value it has at the end, and each
+ * held event is triggered once, with the arguments of the last call.
+ * Notifications are delivered in the order they were first held.
+ *
+ * Batches can be nested. Inner batches join the outermost one and
+ * notifications are delivered only when it ends.
+ *
+ * Notifications are kept in a list and indexed by source, in a hash table
+ * chained through the list positions. Holding a change of each property,
+ * and finding it again, are O(1) amortized operations.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * {
+ *     ss::PropertyBatch batch;
+ *
+ *     record.name  = row.name;
+ *     record.total = row.total;
+ *     record.count = row.count;
+ *     ss::PropertyBatch::trigger(&record.onLoaded, &record);
+ * }   // Notifications delivered here.
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @note Properties and events that are held must live until the batch
+ * ends. Notification handlers run after the batch is closed, so changes
+ * made by them are notified immediately. They must not throw exceptions.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+class PropertyBatch
+{
+public:
+    /**
+     * Delivers a held notification.
+     * The first parameter is the source object, the second the state kept by
+     * the batch. When the third is \b false the notification is discarded.
+     * The function always releases the state.
+     **/
+    typedef void (*deliver_t)(void *, void *, bool);
+
+    /** @name Constructors & Destructor */ //@{
+    // PropertyBatch();/*{{{*/
+    /**
+     * Starts holding notifications in the calling thread.
+     * @since 1.2
+     **/
+    PropertyBatch() : m_outer(current()) {
+        if (!m_outer) current() = this;
+    }
+    /*}}}*/
+    // ~PropertyBatch();/*{{{*/
+    /**
+     * Delivers the held notifications.
+     * Does nothing when this batch is nested in another one.
+     * @since 1.2
+     **/
+    ~PropertyBatch() {
+        if (m_outer) return;
+
+        current() = NULL;
+        for (size_t i = 0; i < m_entries.size(); ++i)
+            (*m_entries[i].deliver)(m_entries[i].source, m_entries[i].state, true);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // size_t pending() const;/*{{{*/
+    /**
+     * Number of notifications held.
+     * @since 1.2
+     **/
+    size_t pending() const {
+        return (m_outer ? m_outer->pending() : m_entries.size());
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void* find(const void *source) const;/*{{{*/
+    /**
+     * Finds the state held for a source object.
+     * @param source The object that posted the notification.
+     * @return The state passed to `hold()` or \b NULL when \a source has no
+     * notification held.
+     * @since 1.2
+     **/
+    void* find(const void *source) const {
+        if (m_heads.empty()) return NULL;
+
+        size_t pos = m_heads[bucket(source)];
+        while ((pos != npos) && (m_entries[pos].source != source))
+            pos = m_entries[pos].next;
+        return ((pos != npos) ? m_entries[pos].state : NULL);
+    }
+    /*}}}*/
+    // void hold(void *source, deliver_t deliver, void *state);/*{{{*/
+    /**
+     * Holds a notification.
+     * Used by objects that take part in batches. Callers use `find()`
+     * first so each source is held only once.
+     * @param source The object posting the notification.
+     * @param deliver Function that delivers or discards the notification.
+     * @param state State passed to \a deliver.
+     * @since 1.2
+     **/
+    void hold(void *source, deliver_t deliver, void *state) {
+        entry_t entry = { source, deliver, state, npos };
+        try {
+            if (m_entries.size() >= m_heads.size())
+                rehash(m_heads.empty() ? 16 : (m_heads.size() * 2));
+            m_entries.push_back(entry);
+        } catch (...) {
+            (*deliver)(source, state, false);
+            throw;
+        }
+
+        size_t &head = m_heads[bucket(source)];
+        m_entries.back().next = head;
+        head = m_entries.size() - 1;
+    }
+    /*}}}*/
+    //@}
+
+    // Static Functions
+    // static PropertyBatch*& current();/*{{{*/
+    /**
+     * Batch in use by the calling thread.
+     * @return A reference to the pointer of the outermost batch. It is \b
+     * NULL when there is no batch active.
+     * @since 1.2
+     **/
+    static PropertyBatch*& current() {
+        static thread_local PropertyBatch *batch = NULL;
+        return batch;
+    }
+    /*}}}*/
+    // static void trigger(EventT<_Return_t (_Args_t...)> *e, _Params_t&&... args);/*{{{*/
+    /**
+     * Triggers an event or holds it in the current batch.
+     * When there is no batch active the event is triggered immediately.
+     * Otherwise a copy of the arguments is kept and the event is triggered
+     * when the batch ends. Calling this function again for the same event
+     * replaces the arguments held.
+     * @param e The event to trigger.
+     * @param args The arguments to the event.
+     * @since 1.2
+     **/
+    template <typename _Return_t, typename... _Args_t, typename... _Params_t>
+    static void trigger(EventT<_Return_t (_Args_t...)> *e, _Params_t&&... args) {
+        typedef held_t<_Return_t, _Args_t...> held_type;
+        PropertyBatch *batch = current();
+
+        if (!batch) {
+            e->trigger(std::forward<_Params_t>(args)...);
+        } else if (held_type *held = static_cast<held_type *>(batch->find(e))) {
+            held->args = typename held_type::args_t(std::forward<_Params_t>(args)...);
+        } else {
+            batch->hold(e, &held_type::deliver, new held_type(std::forward<_Params_t>(args)...));
+        }
+    }
+    /*}}}*/
+
+private:
+    /** A held notification. */
+    struct entry_t {
+        void *source;               /**< Object that posted it.     */
+        deliver_t deliver;          /**< Delivery function.         */
+        void *state;                /**< State of the notification. */
+        size_t next;                /**< Next position in the chain. */
+    };
+
+    /** Marks the end of a chain. */
+    static const size_t npos = (size_t)-1;
+
+    /** Arguments of a held event. */
+    template <typename _Return_t, typename... _Args_t>
+    struct held_t {
+        typedef EventT<_Return_t (_Args_t...)> event_t;
+        typedef std::tuple<typename std::decay<_Args_t>::type...> args_t;
+
+        args_t args;
+
+        template <typename... _Params_t>
+        explicit held_t(_Params_t&&... params) : args(std::forward<_Params_t>(params)...) { }
+
+        template <size_t... _Index>
+        void apply(event_t *e, sstl::IndexesT<_Index...>) {
+            e->trigger(std::get<_Index>(args)...);
+        }
+
+        static void deliver(void *source, void *state, bool fire) {
+            std::unique_ptr<held_t> held(static_cast<held_t *>(state));
+            if (fire) held->apply(static_cast<event_t *>(source),
+                                  typename sstl::MakeIndexesT<sizeof...(_Args_t)>::type());
+        }
+    };
+
+    /** @name Implementation */ //@{
+    // size_t bucket(const void *source) const;/*{{{*/
+    /**
+     * Maps a source address to a bucket of the index.
+     * @since 1.2
+     **/
+    size_t bucket(const void *source) const {
+        size_t h = reinterpret_cast<size_t>(source);
+        return ((h ^ (h >> 4) ^ (h >> 12)) & (m_heads.size() - 1));
+    }
+    /*}}}*/
+    // void rehash(size_t buckets);/*{{{*/
+    /**
+     * Rebuilds the index with the specified number of buckets.
+     * @param buckets Number of buckets. Must be a power of two.
+     * @since 1.2
+     **/
+    void rehash(size_t buckets) {
+        m_entries.reserve(buckets);
+        m_heads.assign(buckets, (size_t)npos);      /* Not odr-used. */
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            size_t &head = m_heads[bucket(m_entries[i].source)];
+            m_entries[i].next = head;
+            head = i;
+        }
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Disabled Operations */ //@{
+    PropertyBatch(const PropertyBatch &) = delete;
+    PropertyBatch& operator =(const PropertyBatch &) = delete;
+    //@}
+
+    // Data Members
+    PropertyBatch *m_outer;             /**< Outermost batch.       */
+    std::vector<entry_t> m_entries;     /**< Held notifications.    */
+    std::vector<size_t> m_heads;        /**< Heads of source chains. */
+};
+
+}   /* namespace ss */
+
+#endif /* __SSTLBATC_HPP_DEFINED__ */
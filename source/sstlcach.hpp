@@ -0,0 +1,249 @@
+/**
+ * @file
+ * Declares the ro::CachedT class template.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLCACH_HPP_DEFINED__
+#define __SSTLCACH_HPP_DEFINED__
+
+#include <cstddef>
+#include "sstleven.hpp"
+
+namespace ro {
+/**
+ * Read only property that caches the value computed by its getter.
+ * Works like `ro::PropertyT` but the bound getter is called only in the
+ * first read. The result is kept in this object and returned, by const
+ * reference, until the cache is invalidated. Useful for derived values,
+ * like layouts and aggregates, that rarely change but are read very often.
+ *
+ * Invalidation is done by a generation counter: `invalidate()` just
+ * increments it and the getter is called again only in the next read. So,
+ * invalidating a cache many times between two reads costs one computation.
+ * Events can also invalidate the cache. See `link()`.
+ * @tparam _Value_t The type of the property value. Must be default
+ * constructible and assignable.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * class Document {
+ * public:
+ *     ss::EventT<void ()> onChanged;
+ *     ro::CachedT<Layout> layout;
+ *
+ *     Document() {
+ *         layout.bind<Document, &Document::computeLayout>(this);
+ *         layout.link(&onChanged);
+ *     }
+ * private:
+ *     Layout computeLayout() const;
+ * };
+ *
+ * doc.layout().height;     // Computes.
+ * doc.layout().width;      // Cached.
+ * doc.onChanged();         // Computes again in the next read.
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @note This object is not thread safe.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+class CachedT
+{
+public:
+    /** @name Constructor */ //@{
+    // CachedT();/*{{{*/
+    /**
+     * Default constructor.
+     * @since 1.2
+     **/
+    CachedT() : m_host(NULL), m_get(NULL), m_generation(1), m_cached(0) { }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // bool valid() const;/*{{{*/
+    /**
+     * Checks whether the cached value is up to date.
+     * @return \b true when the next read will not call the getter.
+     * @since 1.2
+     **/
+    bool valid() const { return (m_cached == m_generation); }
+    /*}}}*/
+    // size_t generation() const;/*{{{*/
+    /**
+     * Retrieves the current generation of the value.
+     * The generation changes every time the cache is invalidated. Can be
+     * used by other objects to know whether the value may have changed.
+     * @since 1.2
+     **/
+    size_t generation() const { return m_generation; }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void bind(_Host_t *host) { }/*{{{*/
+    /**
+     * Binds the property with the getter member function in the host object.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Method Pointer to the getter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)()>
+    void bind(_Host_t *host) {
+        m_host = (void *)host;
+        m_get  = &getter<_Host_t, _Method>;
+        invalidate();
+    }
+    /*}}}*/
+    // void bind(_Host_t const *host) { }/*{{{*/
+    /**
+     * Binds the property with the getter member function in the host object.
+     * This overloaded version is selected when the getter function is const.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Method Pointer to the getter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)() const>
+    void bind(_Host_t const *host) {
+        m_host = (void *)const_cast<_Host_t*>(host);
+        m_get  = &constget<_Host_t, _Method>;
+        invalidate();
+    }
+    /*}}}*/
+    // const _Value_t& get() const;/*{{{*/
+    /**
+     * Retrieves the value.
+     * Calls the getter function when the cache was invalidated since the
+     * last read.
+     * @return A reference to the cached value. Valid until the next read
+     * after an invalidation.
+     * @since 1.2
+     **/
+    const _Value_t& get() const {
+        if (m_cached != m_generation) {
+            m_value  = (*m_get)(m_host);
+            m_cached = m_generation;
+        }
+        return m_value;
+    }
+    /*}}}*/
+    // void invalidate();/*{{{*/
+    /**
+     * Invalidates the cached value.
+     * Only increments the generation counter. The getter is called in the
+     * next read.
+     * @since 1.2
+     **/
+    void invalidate() { ++m_generation; }
+    /*}}}*/
+    // void link(ss::EventT<_Return_t (_Args_t...)> *e);/*{{{*/
+    /**
+     * Invalidates the cache every time an event is triggered.
+     * @param e The event. Can have any signature. The arguments are
+     * ignored and, for events returning values, a default constructed value
+     * is returned.
+     * @remarks The event keeps a pointer to this object. Call `unlink()` if
+     * this object is destroyed before the event.
+     * @since 1.2
+     **/
+    template <typename _Return_t, typename... _Args_t>
+    void link(ss::EventT<_Return_t (_Args_t...)> *e) {
+        e->template bind<CachedT<_Value_t>, &CachedT<_Value_t>::template expire<_Return_t, _Args_t...> >(this);
+    }
+    /*}}}*/
+    // void unlink(ss::EventT<_Return_t (_Args_t...)> *e);/*{{{*/
+    /**
+     * Undoes a `link()` operation.
+     * @param e The event passed to `link()`.
+     * @since 1.2
+     **/
+    template <typename _Return_t, typename... _Args_t>
+    void unlink(ss::EventT<_Return_t (_Args_t...)> *e) {
+        e->unbound(this);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // operator const _Value_t&() const;/*{{{*/
+    /**
+     * Cast to type operator.
+     * This operator calls #get().
+     * @since 1.2
+     **/
+    operator const _Value_t&() const { return get(); }
+    /*}}}*/
+    // const _Value_t& operator ()() const;/*{{{*/
+    /**
+     * Functor operator.
+     * Calls the #get() function. This operator can be used in places where
+     * the compiler cannot deduce to use the cast operator.
+     * @since 1.2
+     **/
+    const _Value_t& operator ()() const { return get(); }
+    /*}}}*/
+    //@}
+
+private:
+    /** @name Disabled Operations */ //@{
+    CachedT(const CachedT<_Value_t> &) = delete;
+    CachedT& operator =(const CachedT<_Value_t> &) = delete;
+    //@}
+
+    // Typedefs
+    typedef _Value_t (*getfn_t)(void*);
+
+    // _Return_t expire(_Args_t... args);/*{{{*/
+    /**
+     * Delegate bound to linked events.
+     * @since 1.2
+     **/
+    template <typename _Return_t, typename... _Args_t>
+    _Return_t expire(_Args_t...) {
+        invalidate();
+        return _Return_t();
+    }
+    /*}}}*/
+
+    // Static Functions
+    // static _Value_t getter(void *host) { }/*{{{*/
+    /**
+     * Calls the getter member function in \a host.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)()>
+    static _Value_t getter(void *host) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        return (p->*_Method)();
+    }
+    /*}}}*/
+    // static _Value_t constget(void *host) { }/*{{{*/
+    /**
+     * Calls the const getter member function in \a host.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)() const>
+    static _Value_t constget(void *host) {
+        _Host_t const *p = static_cast<_Host_t*>(host);
+        return (p->*_Method)();
+    }
+    /*}}}*/
+
+    // Data Members
+    void *m_host;               /**< Void pointer to the host object. */
+    getfn_t m_get;              /**< Getter function pointer.         */
+    size_t m_generation;        /**< Current generation.              */
+    mutable size_t m_cached;    /**< Generation of the cached value.  */
+    mutable _Value_t m_value;   /**< The cached value.                */
+};
+
+}   /* namespace ro */
+
+#endif /* __SSTLCACH_HPP_DEFINED__ */
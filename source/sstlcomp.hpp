@@ -0,0 +1,762 @@
+/**
+ * @file
+ * Declares the ss::CellT and ss::ComputedT class templates.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLCOMP_HPP_DEFINED__
+#define __SSTLCOMP_HPP_DEFINED__
+
+#include <cstddef>
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "sstleven.hpp"
+
+namespace sstl {
+
+/**
+ * Node of a graph of computed values.
+ * Keeps the links between a value and the values computed from it. Each
+ * node has a level: sources have level zero and a computed node is one
+ * level above its highest dependency. Propagation recomputes the affected
+ * nodes in level order, so each one is recomputed at most once and only
+ * after all its dependencies.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+class CellNode
+{
+public:
+    /** Recomputes a node. Returns \b true when its value changed. */
+    typedef bool (*updatefn_t)(CellNode *);
+    /** Notifies the observers of a node that changed. */
+    typedef void (*notifyfn_t)(CellNode *);
+
+    /** @name Attributes */ //@{
+    // size_t level() const;/*{{{*/
+    /**
+     * Retrieves the level of this node in the graph.
+     * @since 1.2
+     **/
+    size_t level() const { return m_level; }
+    /*}}}*/
+    // bool dependsOn(const CellNode *node) const;/*{{{*/
+    /**
+     * Checks whether this node is computed from another node.
+     * @param node The node to check.
+     * @return \b true when \a node is a direct or indirect dependency of
+     * this node.
+     * @since 1.2
+     **/
+    bool dependsOn(const CellNode *node) const {
+        for (size_t i = 0; i < m_dependencies.size(); ++i) {
+            if ((m_dependencies[i] == node) || m_dependencies[i]->dependsOn(node))
+                return true;
+        }
+        return false;
+    }
+    /*}}}*/
+    //@}
+
+protected:
+    /** @name Constructors & Destructor */ //@{
+    // CellNode(notifyfn_t notify, updatefn_t update);/*{{{*/
+    /**
+     * Builds a node.
+     * @param notify Function called after the node value changes.
+     * @param update Function that recomputes the node. \b NULL for sources.
+     * @since 1.2
+     **/
+    CellNode(notifyfn_t notify, updatefn_t update) : m_level(0),
+        m_update(update), m_notify(notify), m_queued(false) { }
+    /*}}}*/
+    // ~CellNode();/*{{{*/
+    /**
+     * Destructor.
+     * Removes this node from the graph.
+     * @since 1.2
+     **/
+    ~CellNode() {
+        detach();
+        for (size_t i = 0; i < m_dependents.size(); ++i)
+            erase(m_dependents[i]->m_dependencies, this);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Implementation */ //@{
+    // void attach(std::vector<CellNode*> &dependencies);/*{{{*/
+    /**
+     * Sets the dependencies of this node.
+     * Updates the level of this node and of all nodes computed from it.
+     * @param dependencies The new dependencies, without repetitions.
+     * @since 1.2
+     **/
+    void attach(std::vector<CellNode*> &dependencies) {
+        detach();
+        m_dependencies.swap(dependencies);
+
+        size_t level = 0;
+        for (size_t i = 0; i < m_dependencies.size(); ++i) {
+            m_dependencies[i]->m_dependents.push_back(this);
+            level = std::max(level, m_dependencies[i]->m_level + 1);
+        }
+        m_level = level;
+        relevel();
+    }
+    /*}}}*/
+    // void propagate();/*{{{*/
+    /**
+     * Recomputes the nodes affected by a change in this node.
+     * Nodes are recomputed in level order. The ones whose value doesn't
+     * change don't propagate further. After all nodes are updated the
+     * observers of this node and of every recomputed node that changed are
+     * notified.
+     * @remarks When a node fails to recompute, throwing an exception, the
+     * nodes not recomputed yet are taken out of the queue. The next change
+     * of their dependencies recomputes them.
+     * @since 1.2
+     **/
+    void propagate() {
+        std::vector<CellNode*> queue;
+        std::vector<CellNode*> changed(1, this);
+        unqueue_t guard(queue);
+
+        schedule(queue, m_dependents);
+        while (!queue.empty()) {
+            std::pop_heap(queue.begin(), queue.end(), &later);
+            CellNode *node = queue.back();
+            queue.pop_back();
+
+            node->m_queued = false;
+            if ((*node->m_update)(node)) {
+                changed.push_back(node);
+                schedule(queue, node->m_dependents);
+            }
+        }
+
+        for (size_t i = 0; i < changed.size(); ++i)
+            (*changed[i]->m_notify)(changed[i]);
+    }
+    /*}}}*/
+    // void detach();/*{{{*/
+    /**
+     * Removes the links to the dependencies of this node.
+     * @since 1.2
+     **/
+    void detach() {
+        for (size_t i = 0; i < m_dependencies.size(); ++i)
+            erase(m_dependencies[i]->m_dependents, this);
+        m_dependencies.clear();
+    }
+    /*}}}*/
+    // void relevel();/*{{{*/
+    /**
+     * Raises the levels of the nodes computed from this one, when needed.
+     * @since 1.2
+     **/
+    void relevel() {
+        for (size_t i = 0; i < m_dependents.size(); ++i) {
+            CellNode *node = m_dependents[i];
+            if (node->m_level <= m_level) {
+                node->m_level = m_level + 1;
+                node->relevel();
+            }
+        }
+    }
+    /*}}}*/
+    //@}
+
+    // Static Functions
+    // static void schedule(std::vector<CellNode*> &queue, const std::vector<CellNode*> &nodes);/*{{{*/
+    /**
+     * Adds nodes to the propagation queue.
+     * @since 1.2
+     **/
+    static void schedule(std::vector<CellNode*> &queue, const std::vector<CellNode*> &nodes) {
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (nodes[i]->m_queued) continue;
+            queue.push_back(nodes[i]);
+            nodes[i]->m_queued = true;
+            std::push_heap(queue.begin(), queue.end(), &later);
+        }
+    }
+    /*}}}*/
+    // static bool later(const CellNode *a, const CellNode *b);/*{{{*/
+    /**
+     * Orders the propagation queue by level, lowest first.
+     * @since 1.2
+     **/
+    static bool later(const CellNode *a, const CellNode *b) {
+        return (a->m_level > b->m_level);
+    }
+    /*}}}*/
+    // static void erase(std::vector<CellNode*> &list, CellNode *node);/*{{{*/
+    /**
+     * Removes a node from a list.
+     * @since 1.2
+     **/
+    static void erase(std::vector<CellNode*> &list, CellNode *node) {
+        list.erase(std::remove(list.begin(), list.end(), node), list.end());
+    }
+    /*}}}*/
+
+private:
+    /** Takes the nodes left in a propagation queue out of it. */
+    struct unqueue_t {
+        std::vector<CellNode*> &queue;
+
+        unqueue_t(std::vector<CellNode*> &q) : queue(q) { }
+        ~unqueue_t() {
+            for (size_t i = 0; i < queue.size(); ++i)
+                queue[i]->m_queued = false;
+        }
+    };
+
+    /** @name Disabled Operations */ //@{
+    CellNode(const CellNode &) = delete;
+    CellNode& operator =(const CellNode &) = delete;
+    //@}
+
+    // Data Members
+    std::vector<CellNode*> m_dependents;    /**< Nodes computed from this.  */
+    std::vector<CellNode*> m_dependencies;  /**< Nodes this is computed of. */
+    size_t m_level;                         /**< Level in the graph.        */
+    updatefn_t m_update;                    /**< Recomputes the node.       */
+    notifyfn_t m_notify;                    /**< Notifies observers.        */
+    bool m_queued;                          /**< In the propagation queue.  */
+};
+
+/**
+ * Node holding a value of a known type.
+ * Base of `ss::CellT` and `ss::ComputedT`.
+ * @tparam _Value_t The type of the value.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+class CellNodeT : public CellNode
+{
+public:
+    /** The type of the value. */
+    typedef _Value_t value_type;
+    /** Type of the event triggered when the value changes. */
+    typedef ss::EventT<void (const _Value_t&)> event_t;
+
+    /** @name Operations */ //@{
+    // const _Value_t& get() const;/*{{{*/
+    /**
+     * Retrieves the current value.
+     * @since 1.2
+     **/
+    const _Value_t& get() const { return m_value; }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // operator const _Value_t&() const;/*{{{*/
+    /**
+     * Cast to type operator.
+     * @since 1.2
+     **/
+    operator const _Value_t&() const { return m_value; }
+    /*}}}*/
+    // const _Value_t& operator ()() const;/*{{{*/
+    /**
+     * Functor operator.
+     * Same as `get()`.
+     * @since 1.2
+     **/
+    const _Value_t& operator ()() const { return m_value; }
+    /*}}}*/
+    //@}
+
+    /** @name Events */ //@{
+    /**
+     * Triggered after the value changes, with the new value.
+     * When a change propagates, observers are notified after all affected
+     * values are recomputed.
+     * @since 1.2
+     **/
+    event_t changed;
+    //@}
+
+protected:
+    // CellNodeT(const _Value_t &value, updatefn_t update);/*{{{*/
+    /**
+     * Builds the node.
+     * @since 1.2
+     **/
+    CellNodeT(const _Value_t &value, updatefn_t update) :
+        CellNode(&notify, update), m_value(value) { }
+    /*}}}*/
+
+    // static void notify(CellNode *node);/*{{{*/
+    /**
+     * Triggers the `changed` event of a node.
+     * @since 1.2
+     **/
+    static void notify(CellNode *node) {
+        CellNodeT<_Value_t> *cell = static_cast<CellNodeT<_Value_t> *>(node);
+        cell->changed(cell->m_value);
+    }
+    /*}}}*/
+
+    // Data Members
+    _Value_t m_value;           /**< Current value. */
+};
+
+/** Base of expression types. */
+struct ExprBase { };
+
+/**
+ * Expression leaf reading the value of a node.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+struct CellRefT : ExprBase
+{
+    typedef _Value_t value_type;
+
+    const CellNodeT<_Value_t> *node;
+
+    explicit CellRefT(const CellNodeT<_Value_t> *n) : node(n) { }
+    const _Value_t& eval() const { return node->get(); }
+    void collect(std::vector<CellNode*> &list) const {
+        list.push_back(const_cast<CellNodeT<_Value_t> *>(node));
+    }
+};
+
+/**
+ * Expression leaf with a constant value.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+struct ConstantT : ExprBase
+{
+    typedef _Value_t value_type;
+
+    _Value_t value;
+
+    explicit ConstantT(const _Value_t &v) : value(v) { }
+    const _Value_t& eval() const { return value; }
+    void collect(std::vector<CellNode*> &) const { }
+};
+
+/**
+ * Expression applying a binary operator.
+ * @tparam _Op_t Function object implementing the operator.
+ * @tparam _Left_t Expression of the left operand.
+ * @tparam _Right_t Expression of the right operand.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <class _Op_t, class _Left_t, class _Right_t>
+struct BinaryT : ExprBase
+{
+    typedef typename std::decay<decltype(_Op_t()(std::declval<_Left_t>().eval(),
+                                                 std::declval<_Right_t>().eval()))>::type value_type;
+
+    _Left_t left;
+    _Right_t right;
+
+    BinaryT(const _Left_t &l, const _Right_t &r) : left(l), right(r) { }
+    value_type eval() const { return _Op_t()(left.eval(), right.eval()); }
+    void collect(std::vector<CellNode*> &list) const {
+        left.collect(list);
+        right.collect(list);
+    }
+};
+
+/**
+ * Converts an operand to an expression.
+ * Nodes become `CellRefT`, expressions are kept and any other value becomes
+ * a `ConstantT`.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Type_t,
+          bool = std::is_base_of<CellNode, _Type_t>::value,
+          bool = std::is_base_of<ExprBase, _Type_t>::value>
+struct OperandT
+{
+    typedef ConstantT<_Type_t> type;
+    static type make(const _Type_t &value) { return type(value); }
+};
+
+template <typename _Type_t>
+struct OperandT<_Type_t, true, false>
+{
+    typedef CellRefT<typename _Type_t::value_type> type;
+    static type make(const _Type_t &node) { return type(&node); }
+};
+
+template <typename _Type_t>
+struct OperandT<_Type_t, false, true>
+{
+    typedef _Type_t type;
+    static const type& make(const _Type_t &expr) { return expr; }
+};
+
+/**
+ * Checks whether at least one of two types is a node or an expression.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Left_t, typename _Right_t>
+struct IsExprT
+{
+    static const bool value =
+        std::is_base_of<CellNode, _Left_t>::value || std::is_base_of<ExprBase, _Left_t>::value ||
+        std::is_base_of<CellNode, _Right_t>::value || std::is_base_of<ExprBase, _Right_t>::value;
+};
+
+// struct PlusT, MinusT, MultipliesT, DividesT/*{{{*/
+/** Addition. */
+struct PlusT {
+    template <typename A, typename B>
+    auto operator ()(const A &a, const B &b) const -> decltype(a + b) { return a + b; }
+};
+/** Subtraction. */
+struct MinusT {
+    template <typename A, typename B>
+    auto operator ()(const A &a, const B &b) const -> decltype(a - b) { return a - b; }
+};
+/** Multiplication. */
+struct MultipliesT {
+    template <typename A, typename B>
+    auto operator ()(const A &a, const B &b) const -> decltype(a * b) { return a * b; }
+};
+/** Division. */
+struct DividesT {
+    template <typename A, typename B>
+    auto operator ()(const A &a, const B &b) const -> decltype(a / b) { return a / b; }
+};
+/*}}}*/
+
+/**
+ * Result of an operator over cells and expressions.
+ * Empty when none of the operands is a cell or an expression, removing the
+ * operators from the overload set.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <class _Op_t, typename _Left_t, typename _Right_t,
+          bool = IsExprT<_Left_t, _Right_t>::value>
+struct ExprResultT { };
+
+template <class _Op_t, typename _Left_t, typename _Right_t>
+struct ExprResultT<_Op_t, _Left_t, _Right_t, true>
+{
+    typedef BinaryT<_Op_t, typename OperandT<_Left_t>::type, typename OperandT<_Right_t>::type> type;
+
+    static type make(const _Left_t &l, const _Right_t &r) {
+        return type(OperandT<_Left_t>::make(l), OperandT<_Right_t>::make(r));
+    }
+};
+
+// Operators/*{{{*/
+/**
+ * Builds an addition expression.
+ * Found by argument dependent lookup. Applies only when at least one
+ * operand is a cell or an expression.
+ * @since 1.2
+ * @ingroup sstl_properties
+ **/
+template <typename _Left_t, typename _Right_t>
+typename ExprResultT<PlusT, _Left_t, _Right_t>::type operator +(const _Left_t &l, const _Right_t &r) {
+    return ExprResultT<PlusT, _Left_t, _Right_t>::make(l, r);
+}
+/**
+ * Builds a subtraction expression.
+ * @since 1.2
+ * @ingroup sstl_properties
+ **/
+template <typename _Left_t, typename _Right_t>
+typename ExprResultT<MinusT, _Left_t, _Right_t>::type operator -(const _Left_t &l, const _Right_t &r) {
+    return ExprResultT<MinusT, _Left_t, _Right_t>::make(l, r);
+}
+/**
+ * Builds a multiplication expression.
+ * @since 1.2
+ * @ingroup sstl_properties
+ **/
+template <typename _Left_t, typename _Right_t>
+typename ExprResultT<MultipliesT, _Left_t, _Right_t>::type operator *(const _Left_t &l, const _Right_t &r) {
+    return ExprResultT<MultipliesT, _Left_t, _Right_t>::make(l, r);
+}
+/**
+ * Builds a division expression.
+ * @since 1.2
+ * @ingroup sstl_properties
+ **/
+template <typename _Left_t, typename _Right_t>
+typename ExprResultT<DividesT, _Left_t, _Right_t>::type operator /(const _Left_t &l, const _Right_t &r) {
+    return ExprResultT<DividesT, _Left_t, _Right_t>::make(l, r);
+}
+/*}}}*/
+
+}   /* namespace sstl */
+
+namespace ss {
+/**
+ * Source value of a graph of computed values.
+ * Holds a value that can be used in expressions defining `ss::ComputedT`
+ * objects. Changing the value recomputes only the computed values that
+ * depend on it.
+ * @tparam _Value_t The type of the value. Must have an `operator ==`.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+class CellT : public sstl::CellNodeT<_Value_t>
+{
+    typedef sstl::CellNodeT<_Value_t> base_t;
+
+public:
+    /** @name Constructor */ //@{
+    // CellT(const _Value_t &value = _Value_t());/*{{{*/
+    /**
+     * Builds the cell.
+     * @param value The initial value.
+     * @since 1.2
+     **/
+    explicit CellT(const _Value_t &value = _Value_t()) : base_t(value, NULL) { }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // bool set(const _Value_t &value);/*{{{*/
+    /**
+     * Changes the value.
+     * When \a value is different from the current value the computed values
+     * depending on this cell are updated.
+     * @param value The new value.
+     * @return \b true when the value changed. \b false otherwise.
+     * @since 1.2
+     **/
+    bool set(const _Value_t &value) {
+        if (this->m_value == value) return false;
+        this->m_value = value;
+        this->propagate();
+        return true;
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // CellT& operator =(const _Value_t &value);/*{{{*/
+    /**
+     * Assignment operator.
+     * Same as `set()`.
+     * @return A reference to \b this object.
+     * @since 1.2
+     **/
+    CellT& operator =(const _Value_t &value) {
+        set(value); return *this;
+    }
+    /*}}}*/
+    // CellT& operator =(const CellT<_Value_t> &other);/*{{{*/
+    /**
+     * Assignment operator.
+     * Copies the value of another cell. Dependencies are not copied.
+     * @return A reference to \b this object.
+     * @since 1.2
+     **/
+    CellT& operator =(const CellT<_Value_t> &other) {
+        set(other.get()); return *this;
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** @name Disabled Operations */ //@{
+    CellT(const CellT<_Value_t> &) = delete;
+    //@}
+};
+
+/**
+ * Value computed from other values.
+ * Defined as an expression over `ss::CellT` and other `ss::ComputedT`
+ * objects, using the `+`, `-`, `*` and `/` operators. The operators build an
+ * expression tree instead of evaluating anything. The cells used in the
+ * expression are tracked as dependencies and, when one of them changes,
+ * only the values depending on it are recomputed, in dependency order. A
+ * value that is recomputed to the same result doesn't propagate further.
+ * @tparam _Value_t The type of the value. Must have an `operator ==`.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * ss::CellT<double> price(10.0), tax(0.1);
+ * ss::CellT<int> qty(2);
+ * ss::ComputedT<double> subtotal, total;
+ *
+ * subtotal = price * qty;
+ * total = subtotal + subtotal * tax;      // 22.0
+ *
+ * qty = 3;                                // subtotal and total recomputed.
+ * tax = 0.2;                              // Only total recomputed.
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @note The cells used in the expression must live longer than this object
+ * or it must be defined again without them. Cycles are not allowed. This
+ * class is not thread safe.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+class ComputedT : public sstl::CellNodeT<_Value_t>
+{
+    typedef sstl::CellNodeT<_Value_t> base_t;
+
+public:
+    /** @name Constructor & Destructor */ //@{
+    // ComputedT();/*{{{*/
+    /**
+     * Default constructor.
+     * The value is default constructed until an expression is defined.
+     * @since 1.2
+     **/
+    ComputedT() : base_t(_Value_t(), &update), m_expr(NULL), m_eval(NULL),
+        m_free(NULL) { }
+    /*}}}*/
+    // ~ComputedT();/*{{{*/
+    /**
+     * Destructor.
+     * @since 1.2
+     **/
+    ~ComputedT() {
+        if (m_free) (*m_free)(m_expr);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // bool define(const _Expr_t &expression);/*{{{*/
+    /**
+     * Defines the expression that computes the value.
+     * The value is computed at once and, when it changes, propagated to the
+     * values depending on this one.
+     * @param expression An expression built with cells, or a single cell.
+     * @return \b true on success. \b false when the expression uses this
+     * object, directly or indirectly. In this case nothing is changed.
+     * @since 1.2
+     **/
+    template <class _Expr_t>
+    bool define(const _Expr_t &expression) {
+        typedef typename sstl::OperandT<_Expr_t>::type expr_t;
+        static_assert(std::is_convertible<typename expr_t::value_type, _Value_t>::value,
+                      "The expression result must be convertible to the value type");
+
+        std::vector<sstl::CellNode*> list;
+        std::unique_ptr<expr_t> expr(new expr_t(sstl::OperandT<_Expr_t>::make(expression)));
+        expr->collect(list);
+        std::sort(list.begin(), list.end());
+        list.erase(std::unique(list.begin(), list.end()), list.end());
+
+        for (size_t i = 0; i < list.size(); ++i) {
+            if ((list[i] == this) || list[i]->dependsOn(this))
+                return false;
+        }
+
+        if (m_free) (*m_free)(m_expr);
+        m_expr = expr.release();
+        m_eval = &evaluate<expr_t>;
+        m_free = &release<expr_t>;
+        this->attach(list);
+
+        if (update(this)) this->propagate();
+        return true;
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // ComputedT& operator =(const _Expr_t &expression);/*{{{*/
+    /**
+     * Assignment operator.
+     * Same as `define()`.
+     * @return A reference to \b this object.
+     * @since 1.2
+     **/
+    template <class _Expr_t>
+    typename std::enable_if<std::is_base_of<sstl::ExprBase, _Expr_t>::value ||
+                            std::is_base_of<sstl::CellNode, _Expr_t>::value, ComputedT&>::type
+    operator =(const _Expr_t &expression) {
+        define(expression); return *this;
+    }
+    /*}}}*/
+    // ComputedT& operator =(const ComputedT<_Value_t> &other);/*{{{*/
+    /**
+     * Assignment operator.
+     * Defines this value as an alias of \a other, following its changes.
+     * @return A reference to \b this object.
+     * @since 1.2
+     **/
+    ComputedT& operator =(const ComputedT<_Value_t> &other) {
+        define(other); return *this;
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** @name Disabled Operations */ //@{
+    ComputedT(const ComputedT<_Value_t> &) = delete;
+    //@}
+
+    typedef _Value_t (*evalfn_t)(const void *);
+    typedef void (*freefn_t)(void *);
+
+    // Static Functions
+    // static bool update(sstl::CellNode *node);/*{{{*/
+    /**
+     * Recomputes the value.
+     * @return \b true when the value changed.
+     * @since 1.2
+     **/
+    static bool update(sstl::CellNode *node) {
+        ComputedT<_Value_t> *self = static_cast<ComputedT<_Value_t> *>(node);
+        _Value_t value = (*self->m_eval)(self->m_expr);
+        if (self->m_value == value) return false;
+
+        self->m_value = std::move(value);
+        return true;
+    }
+    /*}}}*/
+    // static _Value_t evaluate(const void *expr);/*{{{*/
+    /**
+     * Evaluates the stored expression.
+     * @since 1.2
+     **/
+    template <class _Expr_t>
+    static _Value_t evaluate(const void *expr) {
+        return static_cast<const _Expr_t *>(expr)->eval();
+    }
+    /*}}}*/
+    // static void release(void *expr);/*{{{*/
+    /**
+     * Deletes the stored expression.
+     * @since 1.2
+     **/
+    template <class _Expr_t>
+    static void release(void *expr) {
+        delete static_cast<_Expr_t *>(expr);
+    }
+    /*}}}*/
+
+    // Data Members
+    void *m_expr;               /**< The expression tree.       */
+    evalfn_t m_eval;            /**< Evaluates the expression.  */
+    freefn_t m_free;            /**< Deletes the expression.    */
+};
+
+}   /* namespace ss */
+
+#endif /* __SSTLCOMP_HPP_DEFINED__ */
@@ -0,0 +1,576 @@
+/**
+ * @file
+ * Declares the ss::ConcurrentEventT class template.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLCONC_HPP_DEFINED__
+#define __SSTLCONC_HPP_DEFINED__
+
+#if (__cplusplus < 201103L) && (!defined(_MSC_VER) || (_MSC_VER < 1800))
+#error "sstlconc.hpp requires a C++11 compiler"
+#endif
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "sstlfunc.hpp"
+
+// #define SSTL_CONCURRENT_STRIPES/*{{{*/
+/**
+ * Number of reader counters of each `ss::ConcurrentEventT`.
+ * Each thread uses one of them, so threads triggering the same event on
+ * different cores don't write the same cache line. Each counter takes 64
+ * bytes, twice. Define this macro before including this file to change the
+ * default value.
+ * @since 1.2
+ * @ingroup sstl_events
+ **/
+#ifndef SSTL_CONCURRENT_STRIPES
+#define SSTL_CONCURRENT_STRIPES         8
+#endif
+/*}}}*/
+// #define SSTL_CONCURRENT_RETIRED/*{{{*/
+/**
+ * Maximum number of replaced lists an `ss::ConcurrentEventT` keeps while a
+ * trigger of an older epoch is running. A change reaching it waits for that
+ * trigger to return. Define this macro before including this file to change
+ * the default value.
+ * @since 1.2
+ * @ingroup sstl_events
+ **/
+#ifndef SSTL_CONCURRENT_RETIRED
+#define SSTL_CONCURRENT_RETIRED         64
+#endif
+/*}}}*/
+
+namespace sstl {
+
+/** State of a thread used by `ss::ConcurrentEventT`. */
+struct reader_state_t {
+    size_t stripe;              /**< Index in striped counters.    */
+    size_t depth;               /**< Number of running triggers.   */
+};
+
+// reader_state_t& readerState();/*{{{*/
+/**
+ * State of the calling thread.
+ * Threads get consecutive stripes in the order they first call this
+ * function.
+ * @since 1.2
+ **/
+inline reader_state_t& readerState() {
+    static std::atomic<size_t> next(0);
+    static thread_local reader_state_t state = {
+        next.fetch_add(1, std::memory_order_relaxed), 0
+    };
+    return state;
+}
+/*}}}*/
+
+}   /* namespace sstl */
+
+namespace ss {
+
+/**
+ * Thread safe event class template.
+ * Has the same interface of `ss::EventT` but can be triggered and changed
+ * from different threads at the same time. The `trigger()` operation never
+ * locks. It reads an immutable snapshot of the delegate list that is
+ * published atomically. Operations that change the list (`add()`,
+ * `remove()`, `unbound()`, etc.) are serialized between them. Each one
+ * builds a new copy of the list and swaps it in place of the current one.
+ *
+ * Snapshots replaced by a change are not released immediately since they
+ * can still be in use by a running trigger. Triggers are counted by
+ * \e epoch, in counters split by thread (see `SSTL_CONCURRENT_STRIPES`), so
+ * concurrent triggers don't write the same memory. Replaced snapshots are
+ * kept in a \e retired list. A writer moves that list to the current epoch
+ * and starts a new one: new triggers count in the new epoch. The list is
+ * released when every trigger of the previous epoch has finished. This is
+ * checked by the writers and by the triggers leaving the event. Triggers
+ * that keep overlapping don't delay the release. Triggers never wait. A
+ * change only waits when `SSTL_CONCURRENT_RETIRED` lists are retired, for
+ * the triggers of the previous epoch to return, without holding the lock of
+ * the writers. A change made inside a trigger never waits.
+ * @tparam _Signature_t The signature of the functions to handle this event.
+ * The same as `ss::EventT`.
+ * @remarks This template is intended for events that are triggered a lot
+ * more than changed. Every change costs an allocation and a copy of the
+ * delegate list. Delegates may change the event they are bound to while
+ * it is being triggered. The change will be seen only on the next trigger.
+ * @note Requires C++11.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Signature_t> class ConcurrentEventT;
+
+/**
+ * Concurrent event for functions with any number of arguments.
+ * @tparam _Return_t The return type of the function. Should be void.
+ * @tparam _Args_t Types of the function parameters.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Return_t, typename... _Args_t>
+class ConcurrentEventT<_Return_t (_Args_t...)>
+{
+public:
+    // typedef ss::FunctorT<_Return_t (_Args_t...)> Delegate;/*{{{*/
+    /**
+     * Type of the delegate to be bound to this event.
+     * Functors must be of this type to be bound to this event object.
+     **/
+    typedef ss::FunctorT<_Return_t (_Args_t...)> Delegate;
+    /*}}}*/
+
+    /** @name Constructors & Destructor */ //@{
+    // ConcurrentEventT();/*{{{*/
+    /**
+     * Default constructor.
+     * @since 1.2
+     **/
+    ConcurrentEventT() : m_current(nullptr), m_epoch(0), m_retired(nullptr),
+        m_count(0), m_waiting(nullptr) { }
+    /*}}}*/
+    // ~ConcurrentEventT();/*{{{*/
+    /**
+     * Destructor.
+     * Releases the current and the retired snapshots.
+     * @warning No thread can be triggering this event when it is destroyed.
+     * @since 1.2
+     **/
+    ~ConcurrentEventT() {
+        destroy(m_current.load(std::memory_order_relaxed));
+        destroy(m_retired);
+        destroy(m_waiting.load(std::memory_order_relaxed));
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // size_t count() const;/*{{{*/
+    /**
+     * Retrieves the number of bound functors.
+     * @returns A `size_t` value with the number of bound functors at the
+     * moment of the call.
+     * @since 1.2
+     **/
+    size_t count() const {
+        reader_t guard(this);
+        return (guard.snapshot ? guard.snapshot->items.size() : 0);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void bind(_Target_t *target);/*{{{*/
+    /**
+     * Add a new functor object in the list of delegates.
+     * @tparam _Target_t Type of the target class object which member function
+     * must be called when the event is invoked.
+     * @tparam _Method Pointer to the member function to be invoked.
+     * @param target Pointer to the instance of \a _Target_t object on the \a
+     * _Method will be called.
+     * @since 1.2
+     **/
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...)>
+    void bind(_Target_t *target) {
+        Delegate dl;
+        dl.template bind<_Target_t, _Method>(target);
+        add( dl );
+    }
+    /*}}}*/
+    // void bind(_Target_t const *target);/*{{{*/
+    /**
+     * Add a new functor object in the list of delegates.
+     * This is an overloaded member function.
+     * @tparam _Target_t Type of the target class object which member function
+     * must be called when the event is invoked.
+     * @tparam _Method Pointer to the member function to be invoked.
+     * @param target Pointer to the instance of \a _Target_t object on the \a
+     * _Method will be called.
+     * @since 1.2
+     **/
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...) const>
+    void bind(_Target_t const *target) {
+        Delegate dl;
+        dl.template bind<_Target_t, _Method>(target);
+        add( dl );
+    }
+    /*}}}*/
+    // void unbound(_Target_t *target);/*{{{*/
+    /**
+     * Removes all delegates bound to an object.
+     * @tparam _Target_t Type of the target object. The compiler can deduce
+     * it through the function parameter.
+     * @param target Pointer to the object instance that was used to create
+     * the delegate objects.
+     * @remarks Nothing is published when no delegate is bound to \a target.
+     * @since 1.2
+     **/
+    template <class _Target_t>
+    void unbound(_Target_t *target) {
+        void *host = (void *)target;
+        erase([host](const Delegate &d) { return d.isHost(host); });
+    }
+    /*}}}*/
+    // void link(ConcurrentEventT<_Return_t (_Args_t...)> *e);/*{{{*/
+    /**
+     * Link an event to this event.
+     * @param e Pointer to the event object instance to link. Must have the
+     * same return value and parameters of this event.
+     * @since 1.2
+     **/
+    void link(ConcurrentEventT<_Return_t (_Args_t...)> *e) {
+        bind<ConcurrentEventT<_Return_t (_Args_t...)>,
+            &ConcurrentEventT<_Return_t (_Args_t...)>::relay>(e);
+    }
+    /*}}}*/
+    // void trigger(_Params_t&&... args);/*{{{*/
+    /**
+     * Trigger the functions bound to this event object.
+     * @param args Arguments to pass to the functions. They are passed by
+     * reference down to the bound functions.
+     * @remarks This operation doesn't lock. The list of delegates called is
+     * the one published at the moment the trigger starts.
+     * @since 1.2
+     **/
+    template <typename... _Params_t>
+    void trigger(_Params_t&&... args) {
+        reader_t guard(this);
+        if (!guard.snapshot) return;
+
+        const std::vector<Delegate> &items = guard.snapshot->items;
+        for (size_t i = 0; i < items.size(); ++i)
+            items[i].exec(args...);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Helpers */ //@{
+    // void add(_Target_t *target);/*{{{*/
+    /**
+     * Add a new functor object in the list of delegates.
+     * @tparam _Target_t Type of the target class object which member function
+     * must be called when the event is invoked.
+     * @tparam _Method Pointer to the member function to be invoked.
+     * @param target Pointer to the instance of \a _Target_t object on the \a
+     * _Method will be called.
+     * @since 1.2
+     **/
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...)>
+    void add(_Target_t *target) {
+        Delegate d;
+        d.template bind<_Target_t, _Method>(target);
+        add( d );
+    }
+    /*}}}*/
+    // void add(const Delegate &callback);/*{{{*/
+    /**
+     * Adds a delegate object into the list of this event.
+     * @param callback A reference to the Delegate object to add. The same
+     * delegate will not be added twice to the same event.
+     * @since 1.2
+     **/
+    void add(const Delegate &callback) {
+        std::lock_guard<std::mutex> lock(m_lock);
+        snapshot_t *current = m_current.load(std::memory_order_relaxed);
+
+        if (current) {
+            for (const Delegate &d : current->items) {
+                if (d == callback) return;
+            }
+        }
+        std::unique_ptr<snapshot_t> next(new snapshot_t);
+        if (current) {
+            next->items.reserve(current->items.size() + 1);
+            next->items = current->items;
+        }
+        next->items.push_back(callback);
+        publish(next.release());
+    }
+    /*}}}*/
+    // void remove(_Target_t *target);/*{{{*/
+    /**
+     * Removes a delegate from the list of delegates of this event.
+     * @tparam _Target_t Type of the target class object which member function
+     * used to be called when the event is invoked.
+     * @tparam _Method Pointer to the member function to be removed.
+     * @param target Pointer to the instance of \a _Target_t object on the \a
+     * _Method to be removed.
+     * @since 1.2
+     **/
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...)>
+    void remove(_Target_t *target) {
+        Delegate d;
+        d.template bind<_Target_t, _Method>(target);
+        remove(d);
+    }
+    /*}}}*/
+    // void remove(const Delegate &callback);/*{{{*/
+    /**
+     * Removes a callback function from the list of this event.
+     * @param callback Reference to the delegate object. This delegate object
+     * must be build with the same pointer object and function that was
+     * previously added to this event.
+     * @remarks Nothing is published when \a callback is not in the list.
+     * @since 1.2
+     **/
+    void remove(const Delegate &callback) {
+        erase([&callback](const Delegate &d) { return (d == callback); });
+    }
+    /*}}}*/
+    // void clear();/*{{{*/
+    /**
+     * Removes all delegates of this event.
+     * @since 1.2
+     **/
+    void clear() {
+        std::lock_guard<std::mutex> lock(m_lock);
+        publish(nullptr);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // ConcurrentEventT& operator <<(const Delegate &delegate);/*{{{*/
+    /**
+     * Adds a delegate object into the list of this event.
+     * @param delegate The delegate object to be added.
+     * @return A reference to this event instance.
+     * @since 1.2
+     **/
+    ConcurrentEventT& operator <<(const Delegate &delegate) {
+        add(delegate);
+        return *this;
+    }
+    /*}}}*/
+    // void operator ()(_Params_t&&... args);/*{{{*/
+    /**
+     * Invokes all delegates in the list of this event.
+     * @param args Arguments to pass to the functions.
+     * @since 1.2
+     **/
+    template <typename... _Params_t>
+    void operator ()(_Params_t&&... args) {
+        this->trigger(std::forward<_Params_t>(args)...);
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** Immutable list of delegates. */
+    struct snapshot_t {
+        std::vector<Delegate> items;    /**< Bound delegates.          */
+        snapshot_t *next;               /**< Next in the retired list. */
+
+        snapshot_t() : next(nullptr) { }
+    };
+
+    /** Counter of readers in its own cache line. */
+    struct counter_t {
+        std::atomic<size_t> value;
+        char pad[64 - sizeof(std::atomic<size_t>)];
+
+        counter_t() : value(0) { }
+    };
+
+    // struct reader_t;/*{{{*/
+    /**
+     * Scope of a reader of the published snapshot.
+     * The counter of the thread, in the current epoch, is incremented \e
+     * before the snapshot pointer is read. So, when a writer sees no readers
+     * in an epoch older than a replacement, no one can still be using the
+     * snapshots replaced before it.
+     * @since 1.2
+     **/
+    struct reader_t {
+        const ConcurrentEventT *owner;
+        sstl::reader_state_t &state;
+        counter_t *counter;
+        snapshot_t *snapshot;
+
+        reader_t(const ConcurrentEventT *e) : owner(e), state(sstl::readerState()) {
+            unsigned epoch = owner->m_epoch.load(std::memory_order_relaxed) & 1;
+            counter = &owner->m_readers[epoch][state.stripe % SSTL_CONCURRENT_STRIPES];
+            counter->value.fetch_add(1, std::memory_order_seq_cst);
+            snapshot = owner->m_current.load(std::memory_order_seq_cst);
+            state.depth++;
+        }
+        ~reader_t() {
+            state.depth--;
+            if ((counter->value.fetch_sub(1, std::memory_order_seq_cst) == 1) &&
+                (owner->m_waiting.load(std::memory_order_relaxed) != nullptr))
+            {
+                const_cast<ConcurrentEventT *>(owner)->collect();
+            }
+        }
+    };
+    /*}}}*/
+
+    /** @name Implementation */ //@{
+    // _Return_t relay(_Args_t... args);/*{{{*/
+    /**
+     * Target of linked events.
+     * `trigger()` is a template, so it cannot be bound to a functor. This
+     * function has the exact signature of the event and forwards to it.
+     * @since 1.2
+     **/
+    _Return_t relay(_Args_t... args) {
+        trigger(std::forward<_Args_t>(args)...);
+        return _Return_t();
+    }
+    /*}}}*/
+    // void erase(const _Predicate_t &matches);/*{{{*/
+    /**
+     * Publishes a list without the delegates matching a predicate.
+     * @param matches Function object returning \b true for the delegates to
+     * remove.
+     * @remarks When no delegate matches, nothing is allocated or published.
+     * @since 1.2
+     **/
+    template <class _Predicate_t>
+    void erase(const _Predicate_t &matches) {
+        std::lock_guard<std::mutex> lock(m_lock);
+        snapshot_t *current = m_current.load(std::memory_order_relaxed);
+        if (!current) return;
+
+        const std::vector<Delegate> &items = current->items;
+        size_t i = 0;
+        while ((i < items.size()) && !matches(items[i])) ++i;
+        if (i == items.size()) return;
+
+        std::unique_ptr<snapshot_t> next(new snapshot_t);
+        next->items.reserve(items.size() - 1);
+        next->items.assign(items.begin(), items.begin() + i);
+        for (++i; i < items.size(); ++i) {
+            if (!matches(items[i])) next->items.push_back(items[i]);
+        }
+        publish(next.release());
+    }
+    /*}}}*/
+    // void publish(snapshot_t *next);/*{{{*/
+    /**
+     * Publishes a new snapshot and retires the current one.
+     * When too many snapshots are retired, \c m_lock is released while
+     * waiting for the readers of the previous epoch.
+     * @param next The new snapshot. An empty list is published as \b NULL.
+     * @note Must be called with \c m_lock held.
+     * @since 1.2
+     **/
+    void publish(snapshot_t *next) {
+        if (next && next->items.empty()) { delete next; next = nullptr; }
+
+        snapshot_t *old = m_current.exchange(next, std::memory_order_seq_cst);
+        if (old) {
+            old->next = m_retired;
+            m_retired = old;
+            m_count++;
+        }
+        reclaim();
+
+        if ((m_count < SSTL_CONCURRENT_RETIRED) || sstl::readerState().depth)
+            return;
+
+        unsigned epoch = m_epoch.load(std::memory_order_relaxed);
+        m_lock.unlock();
+        while ((m_epoch.load(std::memory_order_relaxed) == epoch) && !drained(epoch - 1))
+            std::this_thread::yield();
+        m_lock.lock();
+        reclaim();
+    }
+    /*}}}*/
+    // void collect();/*{{{*/
+    /**
+     * Releases the retired snapshots, if no writer is running.
+     * Called by readers leaving the event while snapshots are waiting.
+     * @since 1.2
+     **/
+    void collect() {
+        std::unique_lock<std::mutex> lock(m_lock, std::try_to_lock);
+        if (lock.owns_lock()) reclaim();
+    }
+    /*}}}*/
+    // void reclaim();/*{{{*/
+    /**
+     * Advances the reclamation.
+     * Snapshots waiting for the readers of the previous epoch are released
+     * when they are all gone. Then, the retired snapshots start waiting and
+     * the epoch changes. At most two lists exist: the retired snapshots
+     * don't wait together with the ones replaced before them.
+     * @note Must be called with \c m_lock held.
+     * @since 1.2
+     **/
+    void reclaim() {
+        unsigned epoch = m_epoch.load(std::memory_order_relaxed);
+
+        if (m_waiting.load(std::memory_order_relaxed)) {
+            if (!drained(epoch - 1)) return;
+            destroy(m_waiting.exchange(nullptr, std::memory_order_relaxed));
+        }
+        if (!m_retired) return;
+
+        m_waiting.store(m_retired, std::memory_order_relaxed);
+        m_retired = nullptr;
+        m_count = 0;
+        m_epoch.store(epoch + 1, std::memory_order_seq_cst);
+        if (drained(epoch))
+            destroy(m_waiting.exchange(nullptr, std::memory_order_relaxed));
+    }
+    /*}}}*/
+    // bool drained(unsigned epoch) const;/*{{{*/
+    /**
+     * Checks whether all readers of an epoch left the event.
+     * Only the parity of \a epoch is used.
+     * @since 1.2
+     **/
+    bool drained(unsigned epoch) const {
+        for (size_t i = 0; i < SSTL_CONCURRENT_STRIPES; ++i) {
+            if (m_readers[epoch & 1][i].value.load(std::memory_order_seq_cst) != 0)
+                return false;
+        }
+        return true;
+    }
+    /*}}}*/
+    // static void destroy(snapshot_t *list);/*{{{*/
+    /**
+     * Deletes a list of snapshots.
+     * @since 1.2
+     **/
+    static void destroy(snapshot_t *list) {
+        while (list) {
+            snapshot_t *next = list->next;
+            delete list;
+            list = next;
+        }
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** @name Disabled Operations */ //@{
+    ConcurrentEventT(const ConcurrentEventT &) = delete;
+    ConcurrentEventT& operator =(const ConcurrentEventT &) = delete;
+    //@}
+
+    // Data Members
+    std::atomic<snapshot_t *> m_current;        /**< Published list.        */
+    mutable counter_t m_readers[2][SSTL_CONCURRENT_STRIPES];  /**< Readers by epoch. */
+    std::atomic<unsigned> m_epoch;              /**< Epoch of new readers.  */
+    snapshot_t *m_retired;                      /**< Replaced, not waiting. */
+    size_t m_count;                             /**< Size of m_retired.     */
+    std::atomic<snapshot_t *> m_waiting;        /**< Waiting for readers.   */
+    std::mutex m_lock;                          /**< Serializes writers.    */
+};
+
+}   /* namespace ss */
+
+#endif /* __SSTLCONC_HPP_DEFINED__ */
@@ -11,913 +11,1477 @@
 #ifndef __SSTLEVEN_HPP_DEFINED__
 #define __SSTLEVEN_HPP_DEFINED__
 
-#include <list>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "sstlfunc.hpp"
+#include "sstlinst.hpp"
 
-namespace ss {
-
+// #define SSTL_EVENT_INLINE_DELEGATES/*{{{*/
 /**
- * Main template class for the event system.
- * The class declares a type to be used as event dispatcher. Events are simple
- * functors lists. They can handle calling a list of bound functors passing
- * the same parameter. Events can be created to call functions with a single
- * parameter and no return value. Since the event can be bound to a list of
- * functions, the return value will never be used and all bound functions
- * should return \b void.
- * @tparam _Signature_t The signature of the functions to handle this event.
- * Example: `EventT<void(int)> onSelected;` declares an event to call
- * functions returning void and accepting an \b int as parameter.
- * @remarks We could simplify the declaration to the single parameter of the
- * function since there is no reason to create events returning non-void
- * values. We choose to require the function signature to make the event
- * declaration more easy to read and understand.
- * @warning You should never delete the event owner when processing an event
- * callback function. Since events have a list of callbacks, deleting the
- * container will stop the list processing and others clients will never
- * receive the event.
- * @since 1.0
+ * Number of delegates an `ss::EventT` object stores in its own body.
+ * Events with up to this number of bound delegates never allocate memory.
+ * When more delegates are added the list is moved to a contiguous array
+ * allocated in the heap. Define this macro before including this file to
+ * change the default value.
+ * @since 1.2
  * @ingroup sstl_events
- *//* --------------------------------------------------------------------- */
-template <typename _Signature_t> class EventT;
-
+ **/
+#ifndef SSTL_EVENT_INLINE_DELEGATES
+#define SSTL_EVENT_INLINE_DELEGATES     4
+#endif
+/*}}}*/
+// #define SSTL_EVENT_AWAIT/*{{{*/
 /**
- * Specialization of the EventT template class for functions with three
- * arguments.
- * @tparam _Return_t The return type of the function. Should be void.
- * @tparam _Param1_t Type of first function parameter.
- * @tparam _Param2_t Type of second function parameter.
- * @tparam _Param3_t Type of second function parameter.
- * @since 1.1
+ * Enables `co_await` on `ss::EventT` objects.
+ * Defined as 1 when the compiler supports C++20 coroutines. Define it as 0
+ * before including this file to remove the support.
+ * @since 1.2
  * @ingroup sstl_events
+ **/
+#ifndef SSTL_EVENT_AWAIT
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+#define SSTL_EVENT_AWAIT                1
+#else
+#define SSTL_EVENT_AWAIT                0
+#endif
+#endif
+/*}}}*/
+
+#if SSTL_EVENT_AWAIT
+#include <coroutine>
+#include <optional>
+#include <tuple>
+#endif
+
+namespace sstl {
+
+/**
+ * Contiguous array with a small inline buffer.
+ * Holds up to \a _Inline items inside the object it self. When more items
+ * are added the array is moved to a buffer allocated in the heap, growing
+ * geometrically. Items are kept in insertion order. This is the storage used
+ * by `ss::EventT` to keep its list of delegates.
+ * @tparam _Item_t Type of the items. Must be default constructible and
+ * copyable. Should be a small and cheap to copy type.
+ * @tparam _Inline Number of items held in the inline buffer. Must be greater
+ * than zero.
+ * @note When the array grows the previous buffer is released. References
+ * to its items are invalid after any function that adds items. Code that
+ * keeps using an item while others can be added must work on a copy.
+ * @since 1.2
  *//* --------------------------------------------------------------------- */
-template <typename _Return_t, typename _Param1_t, typename _Param2_t, typename _Param3_t>
-class EventT<_Return_t (_Param1_t, _Param2_t, _Param3_t)>
+template <class _Item_t, size_t _Inline>
+class SmallArrayT
 {
 public:
-    // typedef typename ss::FunctorT<_Return_t (_Param1_t, _Param2_t, _Param3_t)> Delegate;/*{{{*/
-    /**
-     * Type of the delegate to be bound to this event.
-     * Functors must be of this type to be bound to this event object.
-     **/
-    typedef typename ss::FunctorT<_Return_t (_Param1_t, _Param2_t, _Param3_t)> Delegate;
-    /*}}}*/
-
     /** @name Constructors & Destructor */ //@{
-    // EventT();/*{{{*/
+    // SmallArrayT();/*{{{*/
     /**
      * Default constructor.
-     * @since 1.1
+     * Builds an empty array using the inline buffer.
+     * @since 1.2
      **/
-    EventT() { }
+    SmallArrayT() : m_data(m_inline), m_size(0), m_capacity(_Inline) { }
     /*}}}*/
-    // ~EventT();/*{{{*/
+    // SmallArrayT(const SmallArrayT<_Item_t, _Inline> &other);/*{{{*/
     /**
-     * Default destructor.
-     * @since 1.1
+     * Copy constructor.
+     * @param other Another instance to copy its items.
+     * @since 1.2
      **/
-    ~EventT() {
-        m_delegates.clear();
+    SmallArrayT(const SmallArrayT<_Item_t, _Inline> &other) :
+        m_data(m_inline), m_size(0), m_capacity(_Inline)
+    {
+        assign(other);
     }
     /*}}}*/
-    //@}
-
-    /** @name Attributes */ //@{
-    // size_t count() const;/*{{{*/
+    // ~SmallArrayT();/*{{{*/
     /**
-     * Retrieves the number of bound functors.
-     * @returns A `size_t` value with the number of bound functors.
-     * @since 1.1
+     * Destructor.
+     * Releases the heap buffer, if any.
+     * @since 1.2
      **/
-    size_t count() const { return m_delegates.size(); }
+    ~SmallArrayT() {
+        if (m_data != m_inline) delete[] m_data;
+    }
     /*}}}*/
     //@}
 
-    /** @name Operations */ //@{
-    // void bind(_Target_t *target);/*{{{*/
-    /**
-     * Add a new functor object in the list of delegates.
-     * @tparam _Target_t Type of the target class object which member function
-     * must be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance that owns the function pointed at
-     * \a _Method template parameter.
-     * @since 1.1
-     **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param1_t, _Param2_t, _Param3_t)>
-    void bind(_Target_t *target) {
-        Delegate dl;
-        dl.template bind<_Target_t, _Method>(target);
-        add( dl );
-    }
-    /*}}}*/
-    // void bind(_Target_t const *target);/*{{{*/
-    /**
-     * Add a new functor object in the list of delegates.
-     * This is an overloaded member function.
-     * @tparam _Target_t Type of the target class object which member function
-     * must be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method will be called.
-     * @since 1.1
-     **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param1_t, _Param2_t, _Param3_t)>
-    void bind(_Target_t const *target) {
-        Delegate dl;
-        dl.template bind<_Target_t, _Method>(const_cast<_Target_t*>(target));
-        add( dl );
-    }
-    /*}}}*/
-    // void unbound(_Target_t *target);/*{{{*/
+    /** @name Attributes */ //@{
+    // size_t size() const;/*{{{*/
     /**
-     * Removes a delegate from the delegate list.
-     * @tparam _Target_t Type of the target class object which member function
-     * was used to create the delegate. This template parameter may not be
-     * defined. The compiler can deduce it through the function parameter.
-     * @param target Pointer to the object instance that was used to create
-     * the delegate object. All delegates with this target object will be
-     * removed.
-     * @since 1.1
+     * Retrieves the number of items in the array.
+     * @since 1.2
      **/
-    template <class _Target_t>
-    void unbound(_Target_t *target) {
-        typename std::list<Delegate>::iterator it = m_delegates.begin();
-        while (it != m_delegates.end())
-        {
-            if ((*it).isHost((void *)target))
-                it = m_delegates.erase(it);
-            else
-                ++it;
-        }
-    }
+    size_t size() const { return m_size; }
     /*}}}*/
-    // void link(EventT<_Return_t (_Param1_t, _Param2_t, _Param3_t)> *e);/*{{{*/
+    // bool empty() const;/*{{{*/
     /**
-     * Link an event to this event.
-     * @param e Pointer to the event object instance to link. Must have the
-     * same return value and parameters of this event.
-     * @since 1.0
+     * Checks whether the array has no items.
+     * @since 1.2
      **/
-    void link(EventT<_Return_t (_Param1_t, _Param2_t, _Param3_t)> *e) {
-        bind<EventT<_Return_t (_Param1_t, _Param2_t, _Param3_t)>,
-            &EventT<_Return_t (_Param1_t, _Param2_t, _Param3_t)>::trigger>(e);
-    }
-    /*}}}*/
-    // void trigger(_Param1_t a1, _Param2_t a2, _Param3_t a3);/*{{{*/
-    /**
-     * Trigger the functions bound to this event object.
-     * @param a1 Argument to pass as the first parameter.
-     * @param a2 Argument to pass as the second parameter.
-     * @param a3 Argument to pass as the third parameter.
-     * @since 1.1
-     **/
-    void trigger(_Param1_t a1, _Param2_t a2, _Param3_t a3) {
-        typename std::list< Delegate >::iterator it = m_delegates.begin();
-
-        while (it != m_delegates.end()) {
-            (*it).exec(a1, a2, a3);
-            if (m_delegates.empty()) break;
-            ++it;
-        }
-    }
+    bool empty() const { return (m_size == 0); }
     /*}}}*/
     //@}
 
-    /** @name Helpers */ //@{
-    // void add(_Target_t *target);/*{{{*/
+    /** @name Operations */ //@{
+    // void push_back(const _Item_t &item);/*{{{*/
     /**
-     * Add a new functor object in the list of delegates.
-     * @tparam _Target_t Type of the target class object which member function
-     * must be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method will be called.
-     * @remarks This function uses `add(const Delegate &)` to build and adds
-     * a callback to the list of delegates of this event. This means that
-     * a delegate already added to this event will not be duplicated.
-     * @since 1.1
+     * Appends an item at the end of the array.
+     * @param item The item to copy.
+     * @remarks The array grows only when the current buffer is full. Then
+     * its capacity is doubled.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param1_t, _Param2_t, _Param3_t)>
-    void add(_Target_t *target) {
-        Delegate d; d.template bind<_Target_t, _Method>(target);
-        add( d );
+    void push_back(const _Item_t &item) {
+        if (m_size == m_capacity) reserve(m_capacity * 2);
+        m_data[m_size++] = item;
     }
     /*}}}*/
-    // void add(_Target_t const *target);/*{{{*/
+    // void erase(size_t index);/*{{{*/
     /**
-     * Add a new functor object in the list of delegates.
-     * This is an overloaded member function.
-     * @tparam _Target_t Type of the target class object which member function
-     * must be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method will be called.
-     * @remarks This function uses `add(const Delegate &)` to build and adds
-     * a callback to the list of delegates of this event. This means that
-     * a delegate already added to this event will not be duplicated.
-     * @since 1.1
+     * Removes the item at the specified position.
+     * @param index Zero based index of the item to remove. Items after this
+     * position are moved one position back, keeping their order.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param1_t, _Param2_t, _Param3_t)>
-    void add(_Target_t const *target) {
-        Delegate d;
-        d.template bind<_Target_t, _Method>(const_cast<_Target_t*>(target));
-        add( d );
+    void erase(size_t index) {
+        if (index >= m_size) return;
+        for (size_t i = index + 1; i < m_size; ++i)
+            m_data[i - 1] = m_data[i];
+        --m_size;
     }
     /*}}}*/
-    // void add(const Delegate &callback);/*{{{*/
+    // void clear();/*{{{*/
     /**
-     * Adds a delegate object into the list of this event.
-     * @param callback A reference to the Delegate object to add. The function
-     * will search the internal list of delegates, if this object was already
-     * added the function does nothing. That is, the same delegate will not be
-     * added twice to the same event.
-     * @since 1.1
+     * Removes all items of the array.
+     * The heap buffer, if any, is kept to be used again.
+     * @since 1.2
      **/
-    void add(const Delegate &callback) {
-        typename std::list<Delegate>::iterator it = m_delegates.begin();
-        while (it != m_delegates.end()) {
-            if (callback == *it) return;
-            ++it;
-        }
-        m_delegates.push_back(callback);
-    }
+    void clear() { m_size = 0; }
     /*}}}*/
-    // void remove(_Target_t *target);/*{{{*/
+    // void resize(size_t count);/*{{{*/
     /**
-     * Removes a delegate from the list of delegates of this event.
-     * @tparam _Target_t Type of the target class object which member function
-     * used to be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be removed.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method to be removed.
-     * @since 1.1
+     * Changes the number of items in the array.
+     * @param count New number of items. Items after this position are
+     * dropped. When the array grows the new items are default constructed.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param1_t, _Param2_t, _Param3_t)>
-    void remove(_Target_t *target) {
-        Delegate d;
-        d.template bind<_Target_t, _Method>(target);
-        remove(d);
+    void resize(size_t count) {
+        reserve(count);
+        for (size_t i = m_size; i < count; ++i)
+            m_data[i] = _Item_t();
+        m_size = count;
     }
     /*}}}*/
-    // void remove(_Target_t const *target);/*{{{*/
+    // void reserve(size_t count);/*{{{*/
     /**
-     * Removes a delegate from the list of delegates of this event.
-     * @tparam _Target_t Type of the target class object which member function
-     * used to be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be removed.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method to be removed.
-     * @since 1.1
+     * Assures the array has capacity for, at least, the specified number of
+     * items.
+     * @param count Number of items to reserve space for.
+     * @remarks When the capacity changes the items are copied to a new
+     * buffer and the previous one is deleted, invalidating references to
+     * them.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param1_t, _Param2_t, _Param3_t)>
-    void remove(_Target_t const *target) {
-        Delegate d;
-        d.template bind<_Target_t, _Method>(const_cast<_Target_t*>(target));
-        remove(d);
+    void reserve(size_t count) {
+        if (count <= m_capacity) return;
+
+        _Item_t *buffer = new _Item_t[count];
+        for (size_t i = 0; i < m_size; ++i)
+            buffer[i] = m_data[i];
+
+        if (m_data != m_inline) delete[] m_data;
+        m_data     = buffer;
+        m_capacity = count;
     }
     /*}}}*/
-    // void remove(const Delegate &callback);/*{{{*/
+    // SmallArrayT& assign(const SmallArrayT<_Item_t, _Inline> &other);/*{{{*/
     /**
-     * Removes a callback function from the list of this event.
-     * @param callback Reference to the delegate object. This delegate object
-     * must be build with the same pointer object and function that was
-     * previously added to this event.
-     * @since 1.1
+     * Copies the items of another array into this one.
+     * @param other The array to copy from.
+     * @return A reference to \b this object.
+     * @since 1.2
      **/
-    void remove(const Delegate &callback) {
-        typename std::list<Delegate>::iterator it = m_delegates.begin();
-        while (it != m_delegates.end()) {
-            if ((*it) == callback)
-                it = m_delegates.erase(it);
-            else
-                ++it;
-        }
+    SmallArrayT& assign(const SmallArrayT<_Item_t, _Inline> &other) {
+        if (&other == this) return *this;
+
+        m_size = 0;
+        reserve(other.m_size);
+        for (size_t i = 0; i < other.m_size; ++i)
+            m_data[i] = other.m_data[i];
+        m_size = other.m_size;
+        return *this;
     }
     /*}}}*/
     //@}
 
     /** @name Overloaded Operators */ //@{
-    // EventT& operator <<(const Delegate &delegate);/*{{{*/
+    // _Item_t& operator [](size_t index);/*{{{*/
     /**
-     * Adds a delegate object into the list of this event.
-     * @param delegate The delegate object to be added.
-     * @return A reference to this event instance.
-     * @since 1.0
+     * Access to an item in the array.
+     * @param index Zero based index of the item. No bounds check is done.
+     * @since 1.2
      **/
-    EventT& operator <<(const Delegate &delegate) {
-        m_delegates.push_back(delegate);
-        return *this;
-    }
+    _Item_t& operator [](size_t index) { return m_data[index]; }
     /*}}}*/
-    // void operator ()(_Param1_t a1, _Param2_t a2, _Param3_t a3);/*{{{*/
+    // const _Item_t& operator [](size_t index) const;/*{{{*/
     /**
-     * Invokes all delegates in the list of this event.
-     * @param a1 Argument for first function parameter.
-     * @param a2 Argument for second function parameter.
-     * @param a3 Argument for third function parameter.
-     * @remarks All bound functors will be called in the same sequence as they
-     * was added to the list.
-     * @since 1.0
+     * Access to an item in the array.
+     * @param index Zero based index of the item. No bounds check is done.
+     * @since 1.2
+     **/
+    const _Item_t& operator [](size_t index) const { return m_data[index]; }
+    /*}}}*/
+    // SmallArrayT& operator =(const SmallArrayT<_Item_t, _Inline> &other);/*{{{*/
+    /**
+     * Assignment operator.
+     * @param other The array to copy from.
+     * @return A reference to \b this object.
+     * @since 1.2
      **/
-    void operator ()(_Param1_t a1, _Param2_t a2, _Param3_t a3) {
-        this->trigger(a1, a2, a3);
+    SmallArrayT& operator =(const SmallArrayT<_Item_t, _Inline> &other) {
+        return assign(other);
     }
     /*}}}*/
     //@}
 
 private:
-    std::list<Delegate> m_delegates;
+    // Data Members
+    _Item_t *m_data;                /**< Current buffer (inline or heap).  */
+    size_t m_size;                  /**< Number of items in the array.     */
+    size_t m_capacity;              /**< Number of items in \c m_data.     */
+    _Item_t m_inline[_Inline];      /**< Inline buffer.                    */
 };
 
 /**
- * Specialization of the EventT template class for functions with two
- * arguments.
- * @tparam _Return_t The return type of the function. Should be void.
- * @tparam _Param1_t Type of first function parameter.
- * @tparam _Param2_t Type of second function parameter.
- * @since 1.0
- * @ingroup sstl_events
+ * Shared state of an `ss::Connection`.
+ * Links the connection handles to the position of a delegate in a
+ * `sstl::DelegateListT`. The list keeps \a pos updated when the delegate
+ * moves and clears \a list when the delegate is removed. The node is
+ * deleted when the list and all handles have released it.
+ * @since 1.2
  *//* --------------------------------------------------------------------- */
-template <typename _Return_t, typename _Param1_t, typename _Param2_t>
-class EventT<_Return_t (_Param1_t, _Param2_t)>
+struct LinkNode
 {
-public:
-    // typedef typename ss::FunctorT<_Return_t (_Param1_t, _Param2_t)> Delegate;/*{{{*/
+    /** Type of the function that removes a delegate from its list. */
+    typedef void (*drop_t)(void *list, size_t pos);
+
+    void *list;                     /**< List of the delegate or NULL. */
+    drop_t drop;                    /**< Removes the delegate.         */
+    size_t pos;                     /**< Position of the delegate.     */
+    size_t refs;                    /**< Handles, plus one for the list. */
+
+    // LinkNode(void *owner, drop_t fn, size_t index);/*{{{*/
     /**
-     * Type of the delegate to be bound to this event.
-     * Functors must be of this type to be bound to this event object.
+     * Builds a node with the reference of the list.
+     * @since 1.2
      **/
-    typedef typename ss::FunctorT<_Return_t (_Param1_t, _Param2_t)> Delegate;
+    LinkNode(void *owner, drop_t fn, size_t index) : list(owner), drop(fn),
+        pos(index), refs(1) { }
     /*}}}*/
 
+    /** Adds a reference. */
+    void retain() { ++refs; }
+    /** Removes a reference. The last one deletes the node. */
+    void release() { if (--refs == 0) delete this; }
+    /** Called by the list when the delegate is removed from it. */
+    void detach() { list = NULL; release(); }
+    /** Removes the delegate from its list, if it is still there. */
+    void disconnect() { if (list) (*drop)(list, pos); }
+};
+
+/**
+ * List of delegates used by `ss::EventT`.
+ * Delegates are kept in a contiguous `sstl::SmallArrayT` buffer, so calling
+ * them is a linear scan. The list has an optional \e indexed mode. When
+ * enabled, two hash indexes are kept over the array: one keyed on the
+ * delegate (host and function) and another keyed on the host object. With
+ * them, adding, removing and unbinding delegates are O(1) amortized
+ * operations instead of a full scan of the list.
+ *
+ * The list can be iterated while delegates are removed from it. While a
+ * `Scope` object exists the list is \e locked: removed delegates are
+ * replaced by \e tombstones (default constructed delegates) and keep their
+ * positions. The tombstones are dropped, keeping the order of the other
+ * delegates, when the outermost `Scope` ends. Delegates added while the
+ * list is locked are appended at the end. In not indexed mode removals use
+ * tombstones also when the list is not locked. They are dropped when they
+ * outnumber the delegates or when a `Scope` ends.
+ *
+ * A delegate can also be tracked by a `sstl::LinkNode`, returned by
+ * `connect()`. The list keeps the position of the delegate in the node, so
+ * the delegate is removed without being searched, in O(1) amortized time
+ * in both modes. Lists that never had a connection don't allocate anything
+ * for them.
+ * @tparam _Delegate_t Type of the delegates. An `ss::FunctorT` type.
+ * @note In indexed mode a removed delegate has its position taken by the
+ * last delegate of the list. So, the calling order no longer follows the
+ * order they were added after a removal. This doesn't happen when the list
+ * is locked.
+ * @since 1.2
+ *//* --------------------------------------------------------------------- */
+template <class _Delegate_t>
+class DelegateListT
+{
+public:
+    /**
+     * Locks a list while it is iterated.
+     * Scopes can be nested. The list is compacted when the outermost one
+     * ends, even when it ends by an exception.
+     * @since 1.2
+     **/
+    class Scope
+    {
+    public:
+        /** Locks \a list until this object is destroyed. */
+        explicit Scope(DelegateListT &list) : m_list(list) { ++m_list.m_locks; }
+        /** Unlocks the list, dropping its tombstones. */
+        ~Scope() {
+            if ((--m_list.m_locks == 0) && m_list.m_dead) m_list.compact();
+        }
+
+    private:
+        Scope(const Scope &) = delete;
+        Scope& operator =(const Scope &) = delete;
+
+        DelegateListT &m_list;          /**< The locked list. */
+    };
+
     /** @name Constructors & Destructor */ //@{
-    // EventT();/*{{{*/
+    // DelegateListT();/*{{{*/
     /**
      * Default constructor.
-     * @since 1.0
+     * Builds an empty, not indexed, list.
+     * @since 1.2
      **/
-    EventT() { }
+    DelegateListT() : m_index(NULL), m_links(NULL), m_locks(0), m_dead(0) { }
     /*}}}*/
-    // ~EventT();/*{{{*/
+    // DelegateListT(const DelegateListT<_Delegate_t> &other);/*{{{*/
     /**
-     * Default destructor.
-     * @since 1.0
+     * Copy constructor.
+     * @param other Another list to copy. When \a other is indexed this list
+     * will also be. Connections are not copied.
+     * @since 1.2
      **/
-    ~EventT() {
-        m_delegates.clear();
+    DelegateListT(const DelegateListT<_Delegate_t> &other) :
+        m_items(other.m_items), m_index(NULL), m_links(NULL), m_locks(0),
+        m_dead(other.m_dead)
+    {
+        if (other.m_index) indexed(true);
+        if (m_dead) compact();
+    }
+    /*}}}*/
+    // ~DelegateListT();/*{{{*/
+    /**
+     * Destructor.
+     * Connections still linked to this list become disconnected.
+     * @since 1.2
+     **/
+    ~DelegateListT() {
+        detach();
+        delete m_links;
+        delete m_index;
     }
     /*}}}*/
     //@}
 
     /** @name Attributes */ //@{
-    // size_t count() const;/*{{{*/
+    // size_t size() const;/*{{{*/
     /**
-     * Retrieves the number of bound functors.
-     * @returns A `size_t` value with the number of bound functors.
-     * @since 1.0
+     * Retrieves the number of positions in the list.
+     * @return The number of delegates plus the number of tombstones. This is
+     * the limit used to iterate the list.
+     * @since 1.2
      **/
-    size_t count() const { return m_delegates.size(); }
+    size_t size() const { return m_items.size(); }
     /*}}}*/
-    //@}
-
-    /** @name Operations */ //@{
-    // void bind(_Target_t *target);/*{{{*/
+    // size_t count() const;/*{{{*/
     /**
-     * Add a new functor object in the list of delegates.
-     * @tparam _Target_t Type of the target class object which member function
-     * must be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method will be called.
-     * @since 1.0
+     * Retrieves the number of delegates in the list, not counting
+     * tombstones.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param1_t, _Param2_t)>
-    void bind(_Target_t *target) {
-        Delegate dl;
-        dl.template bind<_Target_t, _Method>(target);
-        add( dl );
-    }
+    size_t count() const { return (m_items.size() - m_dead); }
     /*}}}*/
-    // void bind(_Target_t const *target);/*{{{*/
+    // bool empty() const;/*{{{*/
     /**
-     * Add a new functor object in the list of delegates.
-     * This is an overloaded member function.
-     * @tparam _Target_t Type of the target class object which member function
-     * must be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method will be called.
-     * @since 1.0
+     * Checks whether the list has no delegates.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param1_t, _Param2_t)>
-    void bind(_Target_t const *target) {
-        Delegate dl;
-        dl.template bind<_Target_t, _Method>(const_cast<_Target_t*>(target));
-        add( dl );
+    bool empty() const { return (count() == 0); }
+    /*}}}*/
+    // bool locked() const;/*{{{*/
+    /**
+     * Checks whether a `Scope` is locking this list.
+     * @since 1.2
+     **/
+    bool locked() const { return (m_locks != 0); }
+    /*}}}*/
+    // bool indexed() const;/*{{{*/
+    /**
+     * Checks whether this list is in indexed mode.
+     * @since 1.2
+     **/
+    bool indexed() const { return (m_index != NULL); }
+    /*}}}*/
+    // void indexed(bool enable);/*{{{*/
+    /**
+     * Enables or disables the indexed mode.
+     * @param enable \b true to build the indexes. \b false to drop them.
+     * @since 1.2
+     **/
+    void indexed(bool enable) {
+        if (!enable) {
+            delete m_index;
+            m_index = NULL;
+        } else if (!m_index) {
+            if (m_dead && !m_locks) compact();
+            m_index = new index_t;
+            rehash(16);
+        }
     }
     /*}}}*/
-    // void unbound(_Target_t *target);/*{{{*/
+    //@}
+
+    /** @name Operations */ //@{
+    // size_t find(const _Delegate_t &d) const;/*{{{*/
+    /**
+     * Searches a delegate in the list.
+     * @param d The delegate to search for.
+     * @return The position of the first delegate equal to \a d or \c npos
+     * when it is not in the list.
+     * @since 1.2
+     **/
+    size_t find(const _Delegate_t &d) const {
+        if (m_index) {
+            size_t pos = m_index->keyHead[bucket(d.hash())];
+            while ((pos != npos) && !(m_items[pos] == d))
+                pos = m_index->keyNext[pos];
+            return pos;
+        }
+        for (size_t i = 0; i < m_items.size(); ++i) {
+            if (m_items[i] == d) return i;
+        }
+        return npos;
+    }
+    /*}}}*/
+    // bool add(const _Delegate_t &d);/*{{{*/
     /**
-     * Removes a delegate from the delegate list.
-     * @tparam _Target_t Type of the target class object which member function
-     * was used to create the delegate. This template parameter may not be
-     * defined. The compiler can deduce it through the function parameter.
-     * @param target Pointer to the object instance that was used to create
-     * the delegate object. All delegates with this target object will be
-     * removed.
-     * @since 1.0
+     * Adds a delegate at the end of the list, if it is not there yet.
+     * @param d The delegate to add.
+     * @return \b true when the delegate was added. \b false when it was
+     * already in the list.
+     * @since 1.2
      **/
-    template <class _Target_t>
-    void unbound(_Target_t *target) {
-        typename std::list<Delegate>::iterator it = m_delegates.begin();
-        while (it != m_delegates.end())
-        {
-            if ((*it).isHost((void *)target))
-                it = m_delegates.erase(it);
-            else
-                ++it;
+    bool add(const _Delegate_t &d) {
+        if (find(d) != npos) return false;
+        append(d);
+        return true;
+    }
+    /*}}}*/
+    // void append(const _Delegate_t &d);/*{{{*/
+    /**
+     * Adds a delegate at the end of the list without checking duplicates.
+     * @param d The delegate to add.
+     * @since 1.2
+     **/
+    void append(const _Delegate_t &d) {
+        m_items.push_back(d);
+        if (m_links) m_links->push_back(NULL);
+        if (!m_index) return;
+
+        size_t pos = m_items.size() - 1;
+        if (m_items.size() > m_index->keyHead.size())
+            rehash(m_index->keyHead.size() * 2);
+        else
+            link(pos);
+    }
+    /*}}}*/
+    // LinkNode* connect(const _Delegate_t &d);/*{{{*/
+    /**
+     * Adds a delegate, if it is not in the list yet, and tracks its
+     * position.
+     * @param d The delegate to add.
+     * @return The node that tracks the delegate. Connecting the same
+     * delegate again returns the same node. The node is owned by the list.
+     * Call `LinkNode::retain()` to keep it.
+     * @since 1.2
+     **/
+    LinkNode* connect(const _Delegate_t &d) {
+        size_t pos = find(d);
+        if (pos == npos) {
+            append(d);
+            pos = m_items.size() - 1;
         }
+        if (!m_links) m_links = new std::vector<LinkNode *>(m_items.size(), (LinkNode *)NULL);
+
+        LinkNode *&node = (*m_links)[pos];
+        if (!node) node = new LinkNode(this, &DelegateListT::drop, pos);
+        return node;
     }
     /*}}}*/
-    // void link(EventT<_Return_t (_Param1_t, _Param2_t)> *e);/*{{{*/
+    // void removeAt(size_t pos);/*{{{*/
     /**
-     * Link an event to this event.
-     * @param e Pointer to the event object instance to link. Must have the
-     * same return value and parameters of this event.
-     * @since 1.0
+     * Removes the delegate at the specified position.
+     * @param pos Position of the delegate. Must be less than `size()`.
+     * @since 1.2
      **/
-    void link(EventT<_Return_t (_Param1_t, _Param2_t)> *e) {
-        bind<EventT<_Return_t (_Param1_t, _Param2_t)>,
-            &EventT<_Return_t (_Param1_t, _Param2_t)>::trigger>(e);
+    void removeAt(size_t pos) {
+        if (m_index) erase(pos);
+        else         discard(pos);
     }
     /*}}}*/
-    // void trigger(_Param1_t a1, _Param2_t a2);/*{{{*/
+    // size_t remove(const _Delegate_t &d);/*{{{*/
     /**
-     * Trigger the functions bound to this event object.
-     * @param a1 Argument to pass as the first parameter.
-     * @param a2 Argument to pass as the second parameter.
-     * @since 1.0
+     * Removes all delegates equal to the passed one.
+     * @param d The delegate to remove.
+     * @return The number of delegates removed.
+     * @since 1.2
      **/
-    void trigger(_Param1_t a1, _Param2_t a2) {
-        typename std::list< Delegate >::iterator it = m_delegates.begin();
+    size_t remove(const _Delegate_t &d) {
+        size_t count = 0;
+        if (m_index) {
+            size_t pos;
+            while ((pos = find(d)) != npos) { erase(pos); ++count; }
+            return count;
+        }
 
-        while (it != m_delegates.end()) {
-            (*it).exec(a1, a2);
-            if (m_delegates.empty()) break;
-            ++it;
+        for (size_t i = m_items.size(); i-- > 0; ) {
+            if ((m_items[i] == d) && !dead(m_items[i])) { discard(i); ++count; }
         }
+        return count;
+    }
+    /*}}}*/
+    // size_t removeHost(void *host);/*{{{*/
+    /**
+     * Removes all delegates bound to the specified host object.
+     * @param host Address of the host object.
+     * @return The number of delegates removed.
+     * @since 1.2
+     **/
+    size_t removeHost(void *host) {
+        size_t count = 0;
+        if (m_index) {
+            size_t pos;
+            while ((pos = findHost(host)) != npos) { erase(pos); ++count; }
+            return count;
+        }
+
+        for (size_t i = m_items.size(); i-- > 0; ) {
+            if (m_items[i].isHost(host) && !dead(m_items[i])) { discard(i); ++count; }
+        }
+        return count;
+    }
+    /*}}}*/
+    // void clear();/*{{{*/
+    /**
+     * Removes all delegates of the list.
+     * When the list is locked all delegates become tombstones.
+     * @since 1.2
+     **/
+    void clear() {
+        detach();
+        if (m_locks) {
+            for (size_t i = 0; i < m_items.size(); ++i)
+                m_items[i] = _Delegate_t();
+            m_dead = m_items.size();
+        } else {
+            m_items.clear();
+            if (m_links) m_links->clear();
+            m_dead = 0;
+        }
+        if (m_index) rehash(m_index->keyHead.size());
     }
     /*}}}*/
     //@}
 
-    /** @name Helpers */ //@{
-    // void add(_Target_t *target);/*{{{*/
+    /** @name Overloaded Operators */ //@{
+    // const _Delegate_t& operator [](size_t index) const;/*{{{*/
+    /**
+     * Access a delegate in the list.
+     * @param index Zero based position of the delegate.
+     * @since 1.2
+     **/
+    const _Delegate_t& operator [](size_t index) const { return m_items[index]; }
+    /*}}}*/
+    // DelegateListT& operator =(const DelegateListT<_Delegate_t> &other);/*{{{*/
+    /**
+     * Assignment operator.
+     * @param other Another list to copy. The indexed mode of this list is
+     * kept.
+     * @return A reference to \b this object.
+     * @since 1.2
+     **/
+    DelegateListT& operator =(const DelegateListT<_Delegate_t> &other) {
+        if (&other == this) return *this;
+        detach();
+        m_items = other.m_items;
+        m_dead  = other.m_dead;
+        if (m_links) m_links->assign(m_items.size(), (LinkNode *)NULL);
+        if (m_dead && !m_locks) compact();
+        else if (m_index) rehash(m_index->keyHead.size());
+        return *this;
+    }
+    /*}}}*/
+    //@}
+
+    /** Value returned by `find()` when the delegate is not in the list. */
+    static const size_t npos = (size_t)-1;
+
+private:
+    /** Hash indexes. Chains are linked through delegate positions. */
+    struct index_t {
+        std::vector<size_t> keyHead;    /**< Heads of delegate chains.    */
+        std::vector<size_t> keyNext;    /**< Next position, per delegate. */
+        std::vector<size_t> hostHead;   /**< Heads of host chains.        */
+        std::vector<size_t> hostNext;   /**< Next position, per host.     */
+    };
+
+    /** @name Implementation */ //@{
+    // static bool dead(const _Delegate_t &d);/*{{{*/
     /**
-     * Add a new functor object in the list of delegates.
-     * @tparam _Target_t Type of the target class object which member function
-     * must be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method will be called.
-     * @remarks This function uses `add(const Delegate &)` to build and adds
-     * a callback to the list of delegates of this event. This means that
-     * a delegate already added to this event will not be duplicated.
-     * @since 1.0
+     * Checks whether a position holds a tombstone.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param1_t, _Param2_t)>
-    void add(_Target_t *target) {
-        Delegate d;
-        d.template bind<_Target_t, _Method>(target);
-        add( d );
+    static bool dead(const _Delegate_t &d) {
+        return (d == _Delegate_t());
     }
     /*}}}*/
-    // void add(_Target_t const *target);/*{{{*/
+    // void discard(size_t pos);/*{{{*/
     /**
-     * Add a new functor object in the list of delegates.
-     * This is an overloaded member function.
-     * @tparam _Target_t Type of the target class object which member function
-     * must be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method will be called.
-     * @remarks This function uses `add(const Delegate &)` to build and adds
-     * a callback to the list of delegates of this event. This means that
-     * a delegate already added to this event will not be duplicated.
-     * @since 1.0
+     * Removes the delegate at \a pos, in not indexed mode.
+     * The delegate is replaced by a tombstone. When the list is not locked
+     * and the tombstones outnumber the delegates the list is compacted, so
+     * each removal costs O(1) amortized and the order is kept.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param1_t, _Param2_t)>
-    void add(_Target_t const *target) {
-        Delegate d;
-        d.template bind<_Target_t, _Method>(const_cast<_Target_t*>(target));
-        add( d );
+    void discard(size_t pos) {
+        detach(pos);
+        m_items[pos] = _Delegate_t();
+        ++m_dead;
+        if (!m_locks && (m_dead > count())) compact();
     }
     /*}}}*/
-    // void add(const Delegate &callback);/*{{{*/
+    // void compact();/*{{{*/
     /**
-     * Adds a delegate object into the list of this event.
-     * @param callback A reference to the Delegate object to add. The function
-     * will search the internal list of delegates, if this object was already
-     * added the function does nothing. That is, the same delegate will not be
-     * added twice to the same event.
-     * @since 1.0
+     * Drops all tombstones keeping the order of the delegates.
+     * @since 1.2
      **/
-    void add(const Delegate &callback) {
-        typename std::list<Delegate>::iterator it = m_delegates.begin();
-        while (it != m_delegates.end()) {
-            if (callback == *it) return;
-            ++it;
+    void compact() {
+        size_t count = 0;
+        for (size_t i = 0; i < m_items.size(); ++i) {
+            if (dead(m_items[i])) continue;
+            if (count != i) {
+                m_items[count] = m_items[i];
+                if (m_links) move(i, count);
+            }
+            ++count;
         }
-        m_delegates.push_back(callback);
+        m_items.resize(count);
+        if (m_links) m_links->resize(count);
+        m_dead = 0;
+        if (m_index) rehash(m_index->keyHead.size());
     }
     /*}}}*/
-    // void remove(_Target_t *target);/*{{{*/
+    // void detach(size_t pos);/*{{{*/
     /**
-     * Removes a delegate from the list of delegates of this event.
-     * @tparam _Target_t Type of the target class object which member function
-     * used to be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be removed.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method to be removed.
-     * @since 1.0
+     * Disconnects the node tracking the delegate at \a pos, if any.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param1_t, _Param2_t)>
-    void remove(_Target_t *target) {
-        Delegate d;
-        d.template bind<_Target_t, _Method>(target);
-        remove(d);
+    void detach(size_t pos) {
+        if (!m_links || !(*m_links)[pos]) return;
+        (*m_links)[pos]->detach();
+        (*m_links)[pos] = NULL;
     }
     /*}}}*/
-    // void remove(_Target_t const *target);/*{{{*/
+    // void detach();/*{{{*/
     /**
-     * Removes a delegate from the list of delegates of this event.
-     * @tparam _Target_t Type of the target class object which member function
-     * used to be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be removed.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method to be removed.
-     * @since 1.0
+     * Disconnects all nodes of this list.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param1_t, _Param2_t)>
-    void remove(_Target_t const *target) {
-        Delegate d;
-        d.template bind<_Target_t, _Method>(const_cast<_Target_t*>(target));
-        remove(d);
+    void detach() {
+        if (!m_links) return;
+        for (size_t i = 0; i < m_links->size(); ++i)
+            detach(i);
     }
     /*}}}*/
-    // void remove(const Delegate &callback);/*{{{*/
+    // void move(size_t from, size_t to);/*{{{*/
     /**
-     * Removes a callback function from the list of this event.
-     * @param callback Reference to the delegate object. This delegate object
-     * must be build with the same pointer object and function that was
-     * previously added to this event.
-     * @since 1.0
+     * Moves the node tracking the delegate at \a from to \a to.
+     * @since 1.2
      **/
-    void remove(const Delegate &callback) {
-        typename std::list<Delegate>::iterator it = m_delegates.begin();
-        while (it != m_delegates.end()) {
-            if ((*it) == callback)
-                it = m_delegates.erase(it);
-            else
-                ++it;
-        }
+    void move(size_t from, size_t to) {
+        LinkNode *node = (*m_links)[from];
+        (*m_links)[to]   = node;
+        (*m_links)[from] = NULL;
+        if (node) node->pos = to;
     }
     /*}}}*/
-    //@}
-
-    /** @name Overloaded Operators */ //@{
-    // EventT& operator <<(const Delegate &delegate);/*{{{*/
+    // static void drop(void *list, size_t pos);/*{{{*/
     /**
-     * Adds a delegate object into the list of this event.
-     * @param delegate The delegate object to be added.
-     * @return A reference to this event instance.
-     * @since 1.0
+     * Removes a delegate on behalf of a `sstl::LinkNode`.
+     * @since 1.2
      **/
-    EventT& operator <<(const Delegate &delegate) {
-        m_delegates.push_back(delegate);
-        return *this;
+    static void drop(void *list, size_t pos) {
+        static_cast<DelegateListT *>(list)->removeAt(pos);
     }
     /*}}}*/
-    // void operator ()(_Param1_t a1, _Param2_t a2);/*{{{*/
+    // size_t bucket(size_t hash) const;/*{{{*/
     /**
-     * Invokes all delegates in the list of this event.
-     * @param a1 Argument for first function parameter.
-     * @param a2 Argument for second function parameter.
-     * @remarks All bound functors will be called in the same sequence as they
-     * was added to the list.
-     * @since 1.0
+     * Maps a hash value to a bucket of the indexes.
+     * @since 1.2
      **/
-    void operator ()(_Param1_t a1, _Param2_t a2) {
-        this->trigger(a1, a2);
+    size_t bucket(size_t hash) const {
+        return (hash & (m_index->keyHead.size() - 1));
     }
     /*}}}*/
-    //@}
-
-private:
-    std::list<Delegate> m_delegates;
-};
-
-/**
- * Specialization of the EventT template for functions with a parameter.
- * @tparam _Return_t The return type of the function. Should be \b void.
- * @tparam _Param_t Type of the parameter to pass to each bound functor.
- * @since 1.0
- * @ingroup sstl_events
- *//* --------------------------------------------------------------------- */
-template <typename _Return_t, typename _Param_t>
-class EventT<_Return_t (_Param_t)>
-{
-public:
-    // typedef typename ss::FunctorT<_Return_t (_Param_t)> Delegate;/*{{{*/
+    // static size_t hashHost(void *host);/*{{{*/
     /**
-     * Type of the delegate to be bound to this event.
-     * Functors must be of this type to be bound to this event object.
+     * Computes the hash value of a host address.
+     * @since 1.2
      **/
-    typedef typename ss::FunctorT<_Return_t (_Param_t)> Delegate;
+    static size_t hashHost(void *host) {
+        size_t h = reinterpret_cast<size_t>(host);
+        return (h ^ (h >> 4) ^ (h >> 12));
+    }
     /*}}}*/
-
-    /** @name Constructors & Destructor */ //@{
-    // EventT();/*{{{*/
+    // size_t findHost(void *host) const;/*{{{*/
     /**
-     * Default constructor.
-     * @since 1.0
+     * Searches the first delegate bound to a host, in indexed mode.
+     * @since 1.2
      **/
-    EventT() { }
+    size_t findHost(void *host) const {
+        size_t pos = m_index->hostHead[bucket(hashHost(host))];
+        while ((pos != npos) && !m_items[pos].isHost(host))
+            pos = m_index->hostNext[pos];
+        return pos;
+    }
     /*}}}*/
-    // ~EventT();/*{{{*/
+    // void link(size_t pos);/*{{{*/
     /**
-     * Default destructor.
-     * @since 1.0
+     * Inserts the delegate at \a pos in the head of its chains.
+     * @since 1.2
      **/
-    ~EventT() {
-        m_delegates.clear();
+    void link(size_t pos) {
+        index_t &x = *m_index;
+        size_t kb = bucket(m_items[pos].hash());
+        size_t hb = bucket(hashHost(m_items[pos].host()));
+
+        if (x.keyNext.size() <= pos) {
+            x.keyNext.resize(pos + 1);
+            x.hostNext.resize(pos + 1);
+        }
+        x.keyNext[pos]  = x.keyHead[kb];  x.keyHead[kb]  = pos;
+        x.hostNext[pos] = x.hostHead[hb]; x.hostHead[hb] = pos;
     }
     /*}}}*/
-    //@}
+    // static size_t* slot(std::vector<size_t> &head, std::vector<size_t> &next, size_t b, size_t pos);/*{{{*/
+    /**
+     * Finds the link that points to \a pos in the chain of bucket \a b.
+     * @since 1.2
+     **/
+    static size_t* slot(std::vector<size_t> &head, std::vector<size_t> &next, size_t b, size_t pos) {
+        size_t *link = &head[b];
+        while (*link != pos) link = &next[*link];
+        return link;
+    }
+    /*}}}*/
+    // void erase(size_t pos);/*{{{*/
+    /**
+     * Removes the delegate at \a pos, in indexed mode.
+     * The last delegate of the list is moved to the released position. When
+     * the list is locked the delegate is only unlinked from the indexes and
+     * replaced by a tombstone.
+     * @since 1.2
+     **/
+    void erase(size_t pos) {
+        index_t &x = *m_index;
+        size_t last = m_items.size() - 1;
+        size_t kb = bucket(m_items[pos].hash());
+        size_t hb = bucket(hashHost(m_items[pos].host()));
 
-    /** @name Attributes */ //@{
-    // size_t count() const;/*{{{*/
+        *slot(x.keyHead, x.keyNext, kb, pos)   = x.keyNext[pos];
+        *slot(x.hostHead, x.hostNext, hb, pos) = x.hostNext[pos];
+        detach(pos);
+
+        if (m_locks) {
+            m_items[pos] = _Delegate_t();
+            ++m_dead;
+            return;
+        }
+
+        if (pos != last) {
+            kb = bucket(m_items[last].hash());
+            hb = bucket(hashHost(m_items[last].host()));
+
+            *slot(x.keyHead, x.keyNext, kb, last)   = pos;
+            *slot(x.hostHead, x.hostNext, hb, last) = pos;
+            x.keyNext[pos]  = x.keyNext[last];
+            x.hostNext[pos] = x.hostNext[last];
+            m_items[pos] = m_items[last];
+            if (m_links) move(last, pos);
+        }
+        m_items.erase(last);
+        if (m_links) m_links->pop_back();
+    }
+    /*}}}*/
+    // void rehash(size_t buckets);/*{{{*/
     /**
-     * Retrieves the number of bound functors.
-     * @returns A `size_t` value with the number of bound functors.
-     * @since 1.0
+     * Rebuilds the indexes with the specified number of buckets.
+     * @param buckets Number of buckets. Must be a power of two.
+     * @since 1.2
      **/
-    size_t count() const { return m_delegates.size(); }
+    void rehash(size_t buckets) {
+        while (buckets < m_items.size()) buckets *= 2;
+
+        m_index->keyHead.assign(buckets, npos);
+        m_index->hostHead.assign(buckets, npos);
+        m_index->keyNext.resize(m_items.size());
+        m_index->hostNext.resize(m_items.size());
+
+        for (size_t i = 0; i < m_items.size(); ++i)
+            if (!dead(m_items[i])) link(i);
+    }
     /*}}}*/
     //@}
 
-    /** @name Operations */ //@{
-    // void bind(_Target_t *target);/*{{{*/
+    /** Storage type. */
+    typedef SmallArrayT<_Delegate_t, SSTL_EVENT_INLINE_DELEGATES> items_t;
+
+    // Data Members
+    items_t m_items;                /**< Dense list of delegates.      */
+    index_t *m_index;               /**< Indexes, NULL when disabled.  */
+    std::vector<LinkNode *> *m_links;   /**< Connections, per position. */
+    size_t m_locks;                 /**< Number of active scopes.      */
+    size_t m_dead;                  /**< Number of tombstones.         */
+};
+
+template <class _Delegate_t>
+const size_t DelegateListT<_Delegate_t>::npos;
+
+#if SSTL_EVENT_AWAIT
+/**
+ * A node of `sstl::WaitList`.
+ * Is the base of the awaiter objects returned by `ss::EventT::next()`, so
+ * it lives inside the frame of the suspended coroutine.
+ * @since 1.2
+ **/
+struct WaitNode
+{
+    WaitNode *prev;                 /**< Previous node or NULL.  */
+    WaitNode *next;                 /**< Next node or NULL.      */
+
+    /** Builds a node not linked to any list. */
+    WaitNode() : prev(NULL), next(NULL) { }
+    /** Removes the node from its list, if any. */
+    ~WaitNode() { unlink(); }
+
+    /** Removes the node from its list, if any. */
+    void unlink() {
+        if (!next) return;
+        prev->next = next;
+        next->prev = prev;
+        prev = next = NULL;
+    }
+
+private:
+    WaitNode(const WaitNode &) = delete;
+    WaitNode& operator =(const WaitNode &) = delete;
+};
+
+/**
+ * List of coroutines waiting for an `ss::EventT`.
+ * Circular doubly linked list of `sstl::WaitNode` objects, so a node can
+ * leave the list in constant time when its coroutine is destroyed. Nodes
+ * are never allocated by the list.
+ * @since 1.2
+ **/
+class WaitList
+{
+public:
+    /** Builds an empty list. */
+    WaitList() { m_head.prev = m_head.next = &m_head; }
+    /** Copies of a list are empty. Waiters belong to a single event. */
+    WaitList(const WaitList &) : WaitList() { }
+    /** Releases the nodes. Their coroutines are never resumed. */
+    ~WaitList() {
+        while (!empty()) m_head.next->unlink();
+        m_head.prev = m_head.next = NULL;
+    }
+
+    /** Checks whether the list is empty. */
+    bool empty() const { return (m_head.next == &m_head); }
+
+    /** Appends a node at the end of the list. */
+    void push(WaitNode *node) {
+        node->prev = m_head.prev;
+        node->next = &m_head;
+        m_head.prev->next = node;
+        m_head.prev = node;
+    }
+    /** Removes the first node. The list must not be empty. */
+    WaitNode* pop() {
+        WaitNode *node = m_head.next;
+        node->unlink();
+        return node;
+    }
+    /** Moves all nodes of this list to the end of \a other. */
+    void splice(WaitList &other) {
+        while (!empty()) other.push(pop());
+    }
+
+    /** Keeps the nodes. Waiters belong to a single event. */
+    WaitList& operator =(const WaitList &) { return *this; }
+
+private:
+    WaitNode m_head;                /**< Sentinel. */
+};
+#endif /* SSTL_EVENT_AWAIT */
+
+}   /* namespace sstl */
+
+namespace ss {
+
+/**
+ * Combiner that stops at the first delegate returning \b true.
+ * Used with `ss::EventT::combine()` on events whose delegates return a value
+ * convertible to \b bool, like a \e handled flag. The delegates after the
+ * first one returning \b true are not called.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * ss::EventT<bool(const KeyEvent&)> onKey;
+ *
+ * bool handled = onKey.combine(ss::FirstTrue(), key);
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+struct FirstTrue
+{
+    typedef bool result_t;              /**< Type of the result. */
+
+    /** Builds the combiner. */
+    FirstTrue() : m_result(false) { }
+
+    /** Keeps a value. Returns \b false to stop the dispatch. */
+    template <typename _Value_t>
+    bool add(const _Value_t &value) { return !(m_result = (bool)value); }
+
+    /** \b true when a delegate returned \b true. */
+    result_t result() const { return m_result; }
+
+private:
+    bool m_result;                      /**< Result. */
+};
+
+/**
+ * Combiner that stops at the first delegate returning \b false.
+ * Useful for voting, when all delegates must agree. Returns \b true when
+ * all delegates returned \b true or when there is no delegate.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+struct AllTrue
+{
+    typedef bool result_t;              /**< Type of the result. */
+
+    /** Builds the combiner. */
+    AllTrue() : m_result(true) { }
+
+    /** Keeps a value. Returns \b false to stop the dispatch. */
+    template <typename _Value_t>
+    bool add(const _Value_t &value) { return (m_result = (bool)value); }
+
+    /** \b true when no delegate returned \b false. */
+    result_t result() const { return m_result; }
+
+private:
+    bool m_result;                      /**< Result. */
+};
+
+/**
+ * Combiner that sums the values returned by the delegates.
+ * @tparam _Value_t Type of the sum. Must have `operator +=`.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+struct SumT
+{
+    typedef _Value_t result_t;          /**< Type of the result. */
+
+    /** Builds the combiner. \a init is the result when there is no delegate. */
+    explicit SumT(const _Value_t &init = _Value_t()) : m_result(init) { }
+
+    /** Adds a value. Never stops the dispatch. */
+    template <typename _Other_t>
+    bool add(const _Other_t &value) { m_result += value; return true; }
+
+    /** The sum of all values. */
+    const result_t& result() const { return m_result; }
+
+private:
+    _Value_t m_result;                  /**< Result. */
+};
+
+/**
+ * Combiner that keeps the lowest value returned by the delegates.
+ * @tparam _Value_t Type of the values. Must have `operator <`.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+struct MinT
+{
+    typedef _Value_t result_t;          /**< Type of the result. */
+
+    /** Builds the combiner. \a init is the result when there is no delegate. */
+    explicit MinT(const _Value_t &init = _Value_t()) : m_result(init), m_empty(true) { }
+
+    /** Keeps a value. Never stops the dispatch. */
+    bool add(const _Value_t &value) {
+        if (m_empty || (value < m_result)) m_result = value;
+        m_empty = false;
+        return true;
+    }
+
+    /** The lowest value. */
+    const result_t& result() const { return m_result; }
+
+private:
+    _Value_t m_result;                  /**< Result.                */
+    bool m_empty;                       /**< No value was received. */
+};
+
+/**
+ * Combiner that keeps the highest value returned by the delegates.
+ * @tparam _Value_t Type of the values. Must have `operator <`.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+struct MaxT
+{
+    typedef _Value_t result_t;          /**< Type of the result. */
+
+    /** Builds the combiner. \a init is the result when there is no delegate. */
+    explicit MaxT(const _Value_t &init = _Value_t()) : m_result(init), m_empty(true) { }
+
+    /** Keeps a value. Never stops the dispatch. */
+    bool add(const _Value_t &value) {
+        if (m_empty || (m_result < value)) m_result = value;
+        m_empty = false;
+        return true;
+    }
+
+    /** The highest value. */
+    const result_t& result() const { return m_result; }
+
+private:
+    _Value_t m_result;                  /**< Result.                */
+    bool m_empty;                       /**< No value was received. */
+};
+
+/**
+ * Combiner that copies the values returned by the delegates into a buffer
+ * of the caller.
+ * The dispatch stops when the buffer is full, so the delegates after that
+ * are not called. Nothing is allocated.
+ * @tparam _Value_t Type of the values.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * ss::EventT<int(const Proposal&)> onVote;
+ * int votes[16];
+ *
+ * size_t count = onVote.combine(ss::CollectT<int>(votes, 16), proposal);
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+struct CollectT
+{
+    typedef size_t result_t;            /**< Type of the result. */
+
+    /** Builds the combiner over \a capacity items starting at \a buffer. */
+    CollectT(_Value_t *buffer, size_t capacity) : m_buffer(buffer),
+        m_capacity(capacity), m_count(0) { }
+
+    /** Copies a value. Returns \b false when the buffer is full. */
+    template <typename _Other_t>
+    bool add(_Other_t &&value) {
+        if (m_count < m_capacity) m_buffer[m_count++] = std::forward<_Other_t>(value);
+        return (m_count < m_capacity);
+    }
+
+    /** The number of values copied. */
+    result_t result() const { return m_count; }
+
+private:
+    _Value_t *m_buffer;                 /**< Buffer of the caller.  */
+    size_t m_capacity;                  /**< Size of the buffer.    */
+    size_t m_count;                     /**< Values copied.         */
+};
+
+/**
+ * Handle of a delegate bound to an event.
+ * Returned by `ss::EventT::connect()`. Keeps track of the position of the
+ * delegate in the event so `disconnect()` removes it without searching the
+ * list of delegates, in O(1) amortized time. Handles can be copied. All copies refer to the same
+ * delegate.
+ *
+ * Destroying a handle doesn't remove the delegate. Use
+ * `ss::ScopedConnection` for that. When the delegate is removed by other
+ * means, or the event is destroyed, the handle becomes disconnected.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * ss::Connection c = list.onSelectedChanged.connect<MyObject, &MyObject::whenSelectionChanges>(this);
+ * ...
+ * c.disconnect();
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @note Like events, connections are not thread safe.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+class Connection
+{
+public:
+    /** @name Constructors & Destructor */ //@{
+    // Connection();/*{{{*/
     /**
-     * Add a new functor object in the list of delegates.
-     * @tparam _Target_t Type of the target class object which member function
-     * must be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method will be called.
-     * @since 1.0
+     * Default constructor.
+     * Builds a disconnected handle.
+     * @since 1.2
+     **/
+    Connection() : m_node(NULL) { }
+    /*}}}*/
+    // explicit Connection(sstl::LinkNode *node);/*{{{*/
+    /**
+     * Builds a handle over a node returned by `sstl::DelegateListT`.
+     * @param node The node. Can be \b NULL.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param_t)>
-    void bind(_Target_t *target) {
-        Delegate dl;
-        dl.template bind<_Target_t, _Method>(target);
-        add( dl );
+    explicit Connection(sstl::LinkNode *node) : m_node(node) {
+        if (m_node) m_node->retain();
     }
     /*}}}*/
-    // void bind(_Target_t const *target);/*{{{*/
+    // Connection(const Connection &other);/*{{{*/
     /**
-     * Add a new functor object in the list of delegates.
-     * This is an overloaded member function.
-     * @tparam _Target_t Type of the target class object which member function
-     * must be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method will be called.
-     * @since 1.0
+     * Copy constructor.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param_t)>
-    void bind(const _Target_t *target) {
-        Delegate dl;
-        dl.template bind<_Target_t, _Method>(const_cast<_Target_t*>(target));
-        add( dl );
+    Connection(const Connection &other) : m_node(other.m_node) {
+        if (m_node) m_node->retain();
     }
     /*}}}*/
-    // void unbound(_Target_t *target);/*{{{*/
+    // Connection(Connection &&other);/*{{{*/
     /**
-     * Removes a delegate from the delegate list.
-     * @tparam _Target_t Type of the target class object which member function
-     * was used to create the delegate. This template parameter may not be
-     * defined. The compiler can deduce it through the function parameter.
-     * @param target Pointer to the object instance that was used to create
-     * the delegate object. All delegates with this target object will be
-     * removed.
-     * @since 1.0
+     * Move constructor.
+     * \a other becomes disconnected.
+     * @since 1.2
      **/
-    template <class _Target_t>
-    void unbound(_Target_t *target) {
-        typename std::list<Delegate>::iterator it = m_delegates.begin();
-        while (it != m_delegates.end())
-        {
-            if ((*it).isHost((void *)target))
-                it = m_delegates.erase(it);
-            else
-                ++it;
-        }
+    Connection(Connection &&other) noexcept : m_node(other.m_node) {
+        other.m_node = NULL;
     }
     /*}}}*/
-    // void link(EventT<_Return_t (_Param_t)> *e);/*{{{*/
+    // ~Connection();/*{{{*/
     /**
-     * Link an event to this event.
-     * @param e Pointer to the event object instance to link. Must have the
-     * same return value and parameters of this event.
-     * @since 1.0
+     * Destructor.
+     * Releases the handle. The delegate is kept in the event.
+     * @since 1.2
      **/
-    void link(EventT<_Return_t (_Param_t)> *e) {
-        bind<EventT<_Return_t (_Param_t)>, &EventT<_Return_t (_Param_t)>::trigger>(e);
+    ~Connection() {
+        if (m_node) m_node->release();
     }
     /*}}}*/
-    // void trigger(_Param_t param);/*{{{*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // bool connected() const;/*{{{*/
     /**
-     * Trigger the functions bound to this event object.
-     * @param param Argument to pass to the function.
-     * @since 1.0
+     * Checks whether the delegate is still bound to its event.
+     * @since 1.2
      **/
-    void trigger(_Param_t param) {
-        typename std::list< Delegate >::iterator it = m_delegates.begin();
+    bool connected() const { return (m_node && m_node->list); }
+    /*}}}*/
+    //@}
 
-        while (it != m_delegates.end()) {
-            (*it).exec(param);
-            if (m_delegates.empty()) break;
-            ++it;
-        }
+    /** @name Operations */ //@{
+    // void disconnect();/*{{{*/
+    /**
+     * Removes the delegate from its event.
+     * Does nothing when the delegate was already removed. This handle, and
+     * all its copies, become disconnected.
+     * @since 1.2
+     **/
+    void disconnect() {
+        if (!m_node) return;
+        m_node->disconnect();
+        m_node->release();
+        m_node = NULL;
+    }
+    /*}}}*/
+    // void swap(Connection &other);/*{{{*/
+    /**
+     * Exchanges two handles.
+     * @since 1.2
+     **/
+    void swap(Connection &other) noexcept {
+        sstl::LinkNode *node = m_node;
+        m_node = other.m_node;
+        other.m_node = node;
     }
     /*}}}*/
     //@}
 
-    /** @name Helpers */ //@{
-    // void add(_Target_t *target);/*{{{*/
+    /** @name Overloaded Operators */ //@{
+    // Connection& operator =(const Connection &other);/*{{{*/
     /**
-     * Add a new functor object in the list of delegates.
-     * @tparam _Target_t Type of the target class object which member function
-     * must be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method will be called.
-     * @remarks This function uses `add(const Delegate &)` to build and adds
-     * a callback to the list of delegates of this event. This means that
-     * a delegate already added to this event will not be duplicated.
-     * @since 1.0
+     * Assignment operator.
+     * The delegate of the previous connection is kept in its event.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param_t)>
-    void add(_Target_t *target) {
-        Delegate d;
-        d.template bind<_Target_t, _Method>(target);
-        add( d );
+    Connection& operator =(const Connection &other) {
+        Connection(other).swap(*this);
+        return *this;
     }
     /*}}}*/
-    // void add(_Target_t const *target);/*{{{*/
+    // Connection& operator =(Connection &&other);/*{{{*/
     /**
-     * Add a new functor object in the list of delegates.
-     * This is an overloaded member function.
-     * @tparam _Target_t Type of the target class object which member function
-     * must be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method will be called.
-     * @remarks This function uses `add(const Delegate &)` to build and adds
-     * a callback to the list of delegates of this event. This means that
-     * a delegate already added to this event will not be duplicated.
-     * @since 1.0
+     * Move assignment operator.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param_t)>
-    void add(_Target_t const *target) {
-        Delegate d;
-        d.template bind<_Target_t, _Method>(const_cast<_Target_t*>(target));
-        add( d );
+    Connection& operator =(Connection &&other) noexcept {
+        Connection(std::move(other)).swap(*this);
+        return *this;
     }
     /*}}}*/
-    // void add(const Delegate &callback);/*{{{*/
+    //@}
+
+private:
+    // Data Members
+    sstl::LinkNode *m_node;             /**< Shared state or NULL. */
+};
+
+/**
+ * Connection that removes its delegate when destroyed.
+ * Declare one of these as a member of the subscriber object and there is
+ * no need to call `ss::EventT::unbound()` in its destructor.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * class MyObject {
+ *     ss::ScopedConnection m_selection;
+ *
+ * public:
+ *     MyObject(IndexedList &list) {
+ *         m_selection = list.onSelectedChanged.connect<MyObject, &MyObject::whenSelectionChanges>(this);
+ *     }
+ * };
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @warning The event must outlive this object or be destroyed while it is
+ * not being triggered. The handle can be destroyed first.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+class ScopedConnection
+{
+public:
+    /** @name Constructors & Destructor */ //@{
+    // ScopedConnection();/*{{{*/
     /**
-     * Adds a delegate object into the list of this event.
-     * @param callback A reference to the Delegate object to add. The function
-     * will search the internal list of delegates, if this object was already
-     * added the function does nothing. That is, the same delegate will not be
-     * added twice to the same event.
-     * @since 1.0
+     * Default constructor.
+     * @since 1.2
      **/
-    void add(const Delegate &callback) {
-        typename std::list<Delegate>::iterator it = m_delegates.begin();
-        while (it != m_delegates.end()) {
-            if (callback == *it) return;
-            ++it;
-        }
-        m_delegates.push_back(callback);
-    }
+    ScopedConnection() { }
     /*}}}*/
-    // void remove(_Target_t *target);/*{{{*/
+    // ScopedConnection(Connection connection);/*{{{*/
     /**
-     * Removes a delegate from the list of delegates of this event.
-     * @tparam _Target_t Type of the target class object which member function
-     * used to be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be removed.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method to be removed.
-     * @since 1.0
+     * Takes a connection.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param_t)>
-    void remove(_Target_t *target) {
-        Delegate d;
-        d.template bind<_Target_t, _Method>(target);
-        remove( d );
-    }
+    ScopedConnection(Connection connection) : m_connection(std::move(connection)) { }
     /*}}}*/
-    // void remove(_Target_t const *target);/*{{{*/
+    // ScopedConnection(ScopedConnection &&other);/*{{{*/
     /**
-     * Removes a delegate from the list of delegates of this event.
-     * @tparam _Target_t Type of the target class object which member function
-     * used to be called when the event is invoked.
-     * @tparam _Method Pointer to the member function to be removed.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method to be removed.
-     * @since 1.0
+     * Move constructor.
+     * @since 1.2
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Param_t)>
-    void remove(_Target_t const *target) {
-        Delegate d;
-        d.template bind<_Target_t, _Method>(const_cast<_Target_t*>(target));
-        remove( d );
-    }
+    ScopedConnection(ScopedConnection &&other) noexcept :
+        m_connection(std::move(other.m_connection)) { }
     /*}}}*/
-    // void remove(const Delegate &callback);/*{{{*/
+    // ~ScopedConnection();/*{{{*/
     /**
-     * Removes a callback function from the list of this event.
-     * @param callback Reference to the delegate object. This delegate object
-     * must be build with the same pointer object and function that was
-     * previously added to this event.
-     * @since 1.0
+     * Destructor.
+     * Removes the delegate from its event.
+     * @since 1.2
      **/
-    void remove(const Delegate &callback) {
-        typename std::list<Delegate>::iterator it = m_delegates.begin();
-        while (it != m_delegates.end()) {
-            if ((*it) == callback)
-                it = m_delegates.erase(it);
-            else
-                ++it;
-        }
+    ~ScopedConnection() {
+        m_connection.disconnect();
     }
     /*}}}*/
     //@}
 
-    /** @name Overloaded Operators */ //@{
-    // EventT& operator <<(const Delegate &delegate);/*{{{*/
+    /** @name Attributes */ //@{
+    // bool connected() const;/*{{{*/
     /**
-     * Adds a delegate object into the list of this event.
-     * @param delegate The delegate object to be added.
-     * @return A reference to this event instance.
-     * @since 1.0
+     * Checks whether the delegate is still bound to its event.
+     * @since 1.2
      **/
-    EventT& operator <<(const Delegate &delegate) {
-        m_delegates.push_back(delegate);
-        return *this;
+    bool connected() const { return m_connection.connected(); }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void disconnect();/*{{{*/
+    /**
+     * Removes the delegate from its event.
+     * @since 1.2
+     **/
+    void disconnect() { m_connection.disconnect(); }
+    /*}}}*/
+    // Connection release();/*{{{*/
+    /**
+     * Gives up the connection without removing the delegate.
+     * @return The connection. This object becomes disconnected.
+     * @since 1.2
+     **/
+    Connection release() {
+        return Connection(std::move(m_connection));
     }
     /*}}}*/
-    // void operator ()(_Param_t param);/*{{{*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // ScopedConnection& operator =(ScopedConnection &&other);/*{{{*/
     /**
-     * Invokes all delegates in the list of this event.
-     * @tparam _Param_t Type of the parameter. This template parameter may not
-     * be specified since the compiler can deduce it.
-     * @param param Parameter to pass to all bound delegates.
-     * @remarks All bound functors will be called in the same sequence as they
-     * was added to the list.
-     * @since 1.0
+     * Move assignment operator.
+     * The previous delegate is removed from its event.
+     * @since 1.2
      **/
-    void operator ()(_Param_t param) {
-        this->trigger(param);
+    ScopedConnection& operator =(ScopedConnection &&other) noexcept {
+        if (&other == this) return *this;
+        m_connection.disconnect();
+        m_connection = std::move(other.m_connection);
+        return *this;
     }
     /*}}}*/
     //@}
 
 private:
-    std::list<Delegate> m_delegates;
+    /** @name Disabled Operations */ //@{
+    ScopedConnection(const ScopedConnection &) = delete;
+    ScopedConnection& operator =(const ScopedConnection &) = delete;
+    //@}
+
+    // Data Members
+    Connection m_connection;            /**< The connection held. */
 };
 
 /**
- * Specialization of the EventT template class for functions with no
- * parameters.
- * @tparam _Return_t The return type of the function. Should be void.
+ * Main template class for the event system.
+ * The class declares a type to be used as event dispatcher. Events are simple
+ * functors lists. They can handle calling a list of bound functors passing
+ * the same parameter. Events can be created to call functions with a single
+ * parameter and no return value. Since the event can be bound to a list of
+ * functions, the return value will never be used and all bound functions
+ * should return \b void.
+ * @tparam _Signature_t The signature of the functions to handle this event.
+ * Example: `EventT<void(int)> onSelected;` declares an event to call
+ * functions returning void and accepting an \b int as parameter.
+ * @remarks We could simplify the declaration to the single parameter of the
+ * function since there is no reason to create events returning non-void
+ * values. We choose to require the function signature to make the event
+ * declaration more easy to read and understand. Values returned by the
+ * delegates can be combined with `combine()`.
+ * @warning You should never delete the event owner when processing an event
+ * callback function. Since events have a list of callbacks, deleting the
+ * container will stop the list processing and others clients will never
+ * receive the event.
  * @since 1.0
  * @ingroup sstl_events
  *//* --------------------------------------------------------------------- */
-template <typename _Return_t>
-class EventT<_Return_t ()>
+template <typename _Signature_t> class EventT;
+
+/**
+ * Specialization of the EventT template class for functions with any number
+ * of arguments.
+ * @tparam _Return_t The return type of the function. Should be void.
+ * @tparam _Args_t Types of the function parameters.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Return_t, typename... _Args_t>
+class EventT<_Return_t (_Args_t...)>
 {
 public:
-    // typedef typename ss::FunctorT<_Return_t ()> Delegate;/*{{{*/
+    // typedef typename ss::FunctorT<_Return_t (_Args_t...)> Delegate;/*{{{*/
     /**
      * Type of the delegate to be bound to this event.
      * Functors must be of this type to be bound to this event object.
      **/
-    typedef typename ss::FunctorT<_Return_t ()> Delegate;
+    typedef ss::FunctorT<_Return_t (_Args_t...)> Delegate;
+    /*}}}*/
+#if SSTL_EVENT_AWAIT
+    // class Awaiter;/*{{{*/
+    /**
+     * Object returned by `next()` to be used with `co_await`.
+     * The awaiter is kept in the frame of the coroutine, so suspending it
+     * allocates nothing. When the event is triggered a copy of its arguments
+     * is stored in the awaiter and the coroutine is resumed. The result of
+     * `co_await` is nothing for events without arguments, the argument for
+     * events with one argument and a `std::tuple` of the arguments for the
+     * others.
+     * @since 1.2
+     **/
+    class Awaiter : public sstl::WaitNode {
+        friend class EventT;
+        typedef std::tuple<typename std::decay<_Args_t>::type...> args_t;
+        typedef void (*post_t)(void *context, std::coroutine_handle<> handle);
+
+        EventT *m_event;                /**< The awaited event.         */
+        std::coroutine_handle<> m_handle;   /**< The suspended coroutine. */
+        void *m_context;                /**< The scheduler, if any.     */
+        post_t m_post;                  /**< Schedules the coroutine.   */
+        std::optional<args_t> m_args;   /**< Arguments of the trigger.  */
+
+        Awaiter(EventT *e, void *context, post_t post) : m_event(e),
+            m_context(context), m_post(post) { }
+
+        template <typename... _Params_t>
+        void wake(_Params_t&... args) {
+            m_args.emplace(args...);
+            if (m_post) (*m_post)(m_context, m_handle);
+            else        m_handle.resume();
+        }
+
+        template <class _Scheduler_t>
+        static void post(void *context, std::coroutine_handle<> handle) {
+            static_cast<_Scheduler_t *>(context)->schedule(handle);
+        }
+
+    public:
+        /** The event is never ready before it is triggered. */
+        bool await_ready() const noexcept { return false; }
+        /** Queues the coroutine in the event. */
+        void await_suspend(std::coroutine_handle<> handle) {
+            m_handle = handle;
+            m_event->m_waiters.push(this);
+        }
+        /** Retrieves the arguments of the trigger. */
+        decltype(auto) await_resume() {
+            if constexpr (sizeof...(_Args_t) == 0)
+                return;
+            else if constexpr (sizeof...(_Args_t) == 1)
+                return std::move(std::get<0>(*m_args));
+            else
+                return std::move(*m_args);
+        }
+    };
     /*}}}*/
+#endif
 
     /** @name Constructors & Destructor */ //@{
     // EventT();/*{{{*/
@@ -925,7 +1489,11 @@ public:
      * Default constructor.
      * @since 1.0
      **/
+#ifdef SSTL_INSTRUMENT
+    EventT() : m_stats(NULL) { }
+#else
     EventT() { }
+#endif
     /*}}}*/
     // ~EventT();/*{{{*/
     /**
@@ -945,7 +1513,46 @@ public:
      * @returns A `size_t` value with the number of bound functors.
      * @since 1.0
      **/
-    size_t count() const { return m_delegates.size(); }
+    size_t count() const { return m_delegates.count(); }
+    /*}}}*/
+    // bool indexed() const;/*{{{*/
+    /**
+     * Checks whether this event keeps its delegates indexed.
+     * @returns \b true when the indexed mode is enabled. \b false otherwise.
+     * @since 1.2
+     **/
+    bool indexed() const { return m_delegates.indexed(); }
+    /*}}}*/
+    // void indexed(bool enable);/*{{{*/
+    /**
+     * Enables or disables the indexed mode.
+     * In indexed mode the event keeps hash indexes over its delegates making
+     * `add()`, `remove()` and `unbound()` O(1) amortized operations. This is
+     * useful for events having lots of delegates. `trigger()` is not
+     * affected.
+     * @param enable \b true to enable the indexed mode. \b false to
+     * disable.
+     * @note When indexed, removing a delegate changes the order the
+     * remaining ones are called.
+     * @since 1.2
+     **/
+    void indexed(bool enable) { m_delegates.indexed(enable); }
+    /*}}}*/
+    // void instrument(EventStats *stats);/*{{{*/
+    /**
+     * Sets the counters updated by this event.
+     * @param stats The counters. Can be shared by several events. Must
+     * remain valid while this event exists. Pass \b NULL to stop counting.
+     * @remarks This function does nothing when `SSTL_INSTRUMENT` is not
+     * defined. So it can be called unconditionally.
+     * @see sstlinst.hpp
+     * @since 1.2
+     **/
+#ifdef SSTL_INSTRUMENT
+    void instrument(EventStats *stats) { m_stats = stats; }
+#else
+    void instrument(EventStats *) { }
+#endif
     /*}}}*/
     //@}
 
@@ -956,11 +1563,11 @@ public:
      * @tparam _Target_t Type of the target class object which member function
      * must be called when the event is invoked.
      * @tparam _Method Pointer to the member function to be invoked.
-     * @param target Pointer to the instance of \a _Target_t object on the \a
-     * _Method will be called.
+     * @param target Pointer to the instance that owns the function pointed at
+     * \a _Method template parameter.
      * @since 1.0
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)()>
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...)>
     void bind(_Target_t *target) {
         Delegate dl;
         dl.template bind<_Target_t, _Method>(target);
@@ -978,13 +1585,90 @@ public:
      * _Method will be called.
      * @since 1.0
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)()>
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...)>
     void bind(_Target_t const *target) {
         Delegate dl;
         dl.template bind<_Target_t, _Method>(const_cast<_Target_t*>(target));
         add( dl );
     }
     /*}}}*/
+    // Connection connect(_Target_t *target);/*{{{*/
+    /**
+     * Bind a member function to this event returning a connection handle.
+     * @tparam _Target_t Type of the target class object.
+     * @tparam _Method Pointer to the member function to be invoked.
+     * @param target Pointer to the instance of \a _Target_t object on the \a
+     * _Method will be called.
+     * @return The handle of the delegate. `Connection::disconnect()` removes
+     * it without searching the list of delegates. When the delegate was
+     * already bound the handle refers to the existing one.
+     * @remarks Unlike `bind()` this function allocates the shared state of
+     * the handle.
+     * @since 1.2
+     **/
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...)>
+    Connection connect(_Target_t *target) {
+        Delegate dl;
+        dl.template bind<_Target_t, _Method>(target);
+        return connect(dl);
+    }
+    /*}}}*/
+    // Connection connect(const Delegate &callback);/*{{{*/
+    /**
+     * Adds a delegate to this event returning a connection handle.
+     * @param callback The delegate object to add.
+     * @return The handle of the delegate.
+     * @since 1.2
+     **/
+    Connection connect(const Delegate &callback) {
+        return Connection(m_delegates.connect(callback));
+    }
+    /*}}}*/
+#if SSTL_EVENT_AWAIT
+    // Awaiter next();/*{{{*/
+    /**
+     * Waits for the next trigger of this event in a coroutine.
+     * @return The awaiter. Use it with `co_await`. The coroutine is resumed
+     * inside `trigger()`, after the delegates, in the thread that triggered
+     * the event.
+     * @par Example:
+     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * ss::EventT<void(int)> onData;
+     *
+     * Task consume() {
+     *     for (;;) {
+     *         int value = co_await onData.next();
+     *         process(value);
+     *     }
+     * }
+     ~~~~~~~~~~~~~~~~~~~~~
+     * @remarks A coroutine that waits again while it is resumed waits for
+     * the following trigger. Destroying a suspended coroutine removes it
+     * from the event. Coroutines still waiting when the event is destroyed
+     * are never resumed.
+     * @note Available when `SSTL_EVENT_AWAIT` is not zero.
+     * @since 1.2
+     **/
+    Awaiter next() { return Awaiter(this, NULL, NULL); }
+    /*}}}*/
+    // Awaiter next(_Scheduler_t &scheduler);/*{{{*/
+    /**
+     * Waits for the next trigger of this event in a coroutine, resuming it
+     * through a scheduler.
+     * @param scheduler Object with a `schedule(std::coroutine_handle<>)`
+     * member function. It is called by `trigger()` and must resume the
+     * coroutine later, in the thread it chooses. Must remain valid until
+     * then.
+     * @return The awaiter. Use it with `co_await`.
+     * @note Available when `SSTL_EVENT_AWAIT` is not zero.
+     * @since 1.2
+     **/
+    template <class _Scheduler_t>
+    Awaiter next(_Scheduler_t &scheduler) {
+        return Awaiter(this, &scheduler, &Awaiter::template post<_Scheduler_t>);
+    }
+    /*}}}*/
+#endif
     // void unbound(_Target_t *target);/*{{{*/
     /**
      * Removes a delegate from the delegate list.
@@ -998,40 +1682,92 @@ public:
      **/
     template <class _Target_t>
     void unbound(_Target_t *target) {
-        typename std::list<Delegate>::iterator it = m_delegates.begin();
-        while (it != m_delegates.end())
-        {
-            if ((*it).isHost((void *)target))
-                it = m_delegates.erase(it);
-            else
-                ++it;
-        }
+        m_delegates.removeHost((void *)target);
     }
     /*}}}*/
-    // void link(EventT<_Return_t ()> *e);/*{{{*/
+    // void link(EventT<_Return_t (_Args_t...)> *e);/*{{{*/
     /**
      * Link an event to this event.
      * @param e Pointer to the event object instance to link. Must have the
      * same return value and parameters of this event.
      * @since 1.0
      **/
-    void link(EventT<_Return_t ()> *e) {
-        bind<EventT<_Return_t ()>, &EventT<_Return_t ()>::trigger>(e);
+    void link(EventT<_Return_t (_Args_t...)> *e) {
+        bind<EventT<_Return_t (_Args_t...)>, &EventT<_Return_t (_Args_t...)>::relay>(e);
     }
     /*}}}*/
-    // void trigger();/*{{{*/
+    // void trigger(_Params_t&&... args);/*{{{*/
     /**
      * Trigger the functions bound to this event object.
+     * @param args Arguments to pass to the bound functions. They are passed
+     * by reference down to the point where the function is called, so each
+     * delegate makes at most one copy of the parameters declared by value
+     * in the signature.
+     * @remarks Since the same arguments are given to every delegate they are
+     * never moved from.
+     * @remarks A delegate can add or remove delegates, including it self, and
+     * trigger this event again. Each delegate is called from a copy of it,
+     * so its own storage in the list can be overwritten or released while
+     * it runs. Removed delegates are not called anymore. Delegates added
+     * are called in the same trigger, after the ones already in the list.
+     * The list of delegates is not copied: removals are applied when the
+     * outermost trigger returns.
+     * @remarks Coroutines waiting in `next()` are resumed after the
+     * delegates, with a copy of the arguments.
      * @since 1.0
      **/
-    void trigger() {
-        typename std::list< Delegate >::iterator it = m_delegates.begin();
-
-        while (it != m_delegates.end()) {
-            (*it).exec();
-            if (m_delegates.empty()) break;
-            ++it;
+    template <typename... _Params_t>
+    void trigger(_Params_t&&... args) {
+        dispatch(args...);
+#if SSTL_EVENT_AWAIT
+        if (!m_waiters.empty()) resume(args...);
+#endif
+    }
+    /*}}}*/
+    // typename _Combiner_t::result_t combine(_Combiner_t combiner, _Params_t&&... args);/*{{{*/
+    /**
+     * Trigger the functions bound to this event combining their results.
+     * @param combiner Object that receives the value returned by each
+     * delegate, in order, through its `bool add(value)` function. When
+     * `add()` returns \b false the remaining delegates are not called. The
+     * library has `ss::FirstTrue`, `ss::AllTrue`, `ss::SumT`, `ss::MinT`,
+     * `ss::MaxT` and `ss::CollectT`.
+     * @param args Arguments to pass to the bound functions. They are passed
+     * in the same way as in `trigger()`.
+     * @return The value of `combiner.result()` after the dispatch.
+     * @par Example:
+     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * ss::EventT<int(int)> onCost;
+     * int total = onCost.combine(ss::SumT<int>(), 10);
+     ~~~~~~~~~~~~~~~~~~~~~
+     * @remarks Available only for events whose delegates return a value.
+     * @remarks When instrumented, the sampled calls are timed as in
+     * `trigger()`. The time of a call includes the `add()` of its result.
+     * @since 1.2
+     **/
+    template <class _Combiner_t, typename... _Params_t>
+    typename _Combiner_t::result_t combine(_Combiner_t combiner, _Params_t&&... args) {
+        static_assert(!std::is_void<_Return_t>::value, "combine() requires delegates returning a value");
+        typename delegates_t::Scope scope(m_delegates);
+#ifdef SSTL_INSTRUMENT
+        if (m_stats && m_stats->hit()) {
+            for (size_t i = 0, pos = 0; i < m_delegates.size(); ++i) {
+                Delegate delegate = m_delegates[i];
+                if (!delegate) continue;        /* Tombstone. */
+                uint64_t start = sstl::cycles();
+                bool more = combiner.add(delegate.exec(args...));
+                m_stats->sample(pos++, sstl::cycles() - start);
+                if (!more) break;
+            }
+            return combiner.result();
+        }
+#endif
+        for (size_t i = 0; i < m_delegates.size(); ++i) {
+            Delegate delegate = m_delegates[i];
+            if (!delegate) continue;            /* Tombstone. */
+            if (!combiner.add(delegate.exec(args...))) break;
         }
+        return combiner.result();
     }
     /*}}}*/
     //@}
@@ -1050,10 +1786,9 @@ public:
      * a delegate already added to this event will not be duplicated.
      * @since 1.0
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)()>
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...)>
     void add(_Target_t *target) {
-        Delegate d;
-        d.template bind<_Target_t, _Method>(target);
+        Delegate d; d.template bind<_Target_t, _Method>(target);
         add( d );
     }
     /*}}}*/
@@ -1071,7 +1806,7 @@ public:
      * a delegate already added to this event will not be duplicated.
      * @since 1.0
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)()>
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...)>
     void add(_Target_t const *target) {
         Delegate d;
         d.template bind<_Target_t, _Method>(const_cast<_Target_t*>(target));
@@ -1088,12 +1823,7 @@ public:
      * @since 1.0
      **/
     void add(const Delegate &callback) {
-        typename std::list<Delegate>::iterator it = m_delegates.begin();
-        while (it != m_delegates.end()) {
-            if (callback == *it) return;
-            ++it;
-        }
-        m_delegates.push_back(callback);
+        m_delegates.add(callback);
     }
     /*}}}*/
     // void remove(_Target_t *target);/*{{{*/
@@ -1106,7 +1836,7 @@ public:
      * _Method to be removed.
      * @since 1.0
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)()>
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...)>
     void remove(_Target_t *target) {
         Delegate d;
         d.template bind<_Target_t, _Method>(target);
@@ -1123,7 +1853,7 @@ public:
      * _Method to be removed.
      * @since 1.0
      **/
-    template <class _Target_t, _Return_t (_Target_t::*_Method)()>
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...)>
     void remove(_Target_t const *target) {
         Delegate d;
         d.template bind<_Target_t, _Method>(const_cast<_Target_t*>(target));
@@ -1139,13 +1869,7 @@ public:
      * @since 1.0
      **/
     void remove(const Delegate &callback) {
-        typename std::list<Delegate>::iterator it = m_delegates.begin();
-        while (it != m_delegates.end()) {
-            if ((*it) == callback)
-                it = m_delegates.erase(it);
-            else
-                ++it;
-        }
+        m_delegates.remove(callback);
     }
     /*}}}*/
     //@}
@@ -1159,25 +1883,100 @@ public:
      * @since 1.0
      **/
     EventT& operator <<(const Delegate &delegate) {
-        m_delegates.push_back(delegate);
+        m_delegates.append(delegate);
         return *this;
     }
     /*}}}*/
-    // void operator ()();/*{{{*/
+    // void operator ()(_Params_t&&... args);/*{{{*/
     /**
      * Invokes all delegates in the list of this event.
+     * @param args Arguments to pass to the bound functions.
      * @remarks All bound functors will be called in the same sequence as they
      * was added to the list.
      * @since 1.0
      **/
-    void operator ()() {
-        this->trigger();
+    template <typename... _Params_t>
+    void operator ()(_Params_t&&... args) {
+        this->trigger(std::forward<_Params_t>(args)...);
     }
     /*}}}*/
     //@}
 
 private:
-    std::list<Delegate> m_delegates;
+    /** Type of the list of delegates. */
+    typedef sstl::DelegateListT<Delegate> delegates_t;
+
+    // void dispatch(_Params_t&... args);/*{{{*/
+    /**
+     * Calls the bound delegates.
+     * @since 1.2
+     **/
+    template <typename... _Params_t>
+    void dispatch(_Params_t&... args) {
+        typename delegates_t::Scope scope(m_delegates);
+#ifdef SSTL_INSTRUMENT
+        /* Histograms are indexed by the position among the live delegates,
+         * the one they get when the tombstones are released. */
+        if (m_stats && m_stats->hit()) {
+            for (size_t i = 0, pos = 0; i < m_delegates.size(); ++i) {
+                Delegate delegate = m_delegates[i];
+                if (!delegate) continue;        /* Tombstone. */
+                uint64_t start = sstl::cycles();
+                delegate.exec(args...);
+                m_stats->sample(pos++, sstl::cycles() - start);
+            }
+            return;
+        }
+#endif
+        /* Index based loop: a delegate may add delegates making the array
+         * relocate its buffer. Removed ones are left as empty tombstones.
+         * Each delegate is called from a copy: a lambda runs from the
+         * storage of the delegate, that is overwritten when it removes it
+         * self and freed when the array grows. */
+        for (size_t i = 0; i < m_delegates.size(); ++i) {
+            Delegate delegate = m_delegates[i];
+            delegate.exec(args...);
+        }
+    }
+    /*}}}*/
+#if SSTL_EVENT_AWAIT
+    // void resume(_Params_t&... args);/*{{{*/
+    /**
+     * Resumes the coroutines waiting for this event.
+     * The list is taken before the first one is resumed, so coroutines that
+     * wait again are resumed only in the next trigger.
+     * @since 1.2
+     **/
+    template <typename... _Params_t>
+    void resume(_Params_t&... args) {
+        sstl::WaitList ready;
+        m_waiters.splice(ready);
+        while (!ready.empty())
+            static_cast<Awaiter *>(ready.pop())->wake(args...);
+    }
+    /*}}}*/
+#endif
+    // _Return_t relay(_Args_t... args);/*{{{*/
+    /**
+     * Target of linked events.
+     * `trigger()` is a template, so it cannot be bound to a functor. This
+     * function has the exact signature of the event and forwards to it.
+     * @since 1.2
+     **/
+    _Return_t relay(_Args_t... args) {
+        trigger(std::forward<_Args_t>(args)...);
+        return _Return_t();
+    }
+    /*}}}*/
+
+    // Data Members
+    delegates_t m_delegates;        /**< List of bound delegates. */
+#ifdef SSTL_INSTRUMENT
+    EventStats *m_stats;            /**< Counters, when instrumented. */
+#endif
+#if SSTL_EVENT_AWAIT
+    sstl::WaitList m_waiters;       /**< Suspended coroutines.        */
+#endif
 };
 
 }   /* namespace ss */
@@ -11,14 +11,125 @@
 #ifndef __SSTLFUNC_HPP_DEFINED__
 #define __SSTLFUNC_HPP_DEFINED__
 
+#if (__cplusplus < 201103L) && (!defined(_MSC_VER) || (_MSC_VER < 1800))
+#error "The Super Simple Template Library requires a C++11 compiler"
+#endif
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// #define SSTL_FUNCTOR_INLINE_SIZE/*{{{*/
+/**
+ * Size, in bytes, of the inline storage of an `ss::FunctorT` object.
+ * Lambdas and other function objects up to this size can be bound to a
+ * functor. They are stored in the functor body so binding never allocates
+ * memory. The storage overlaps the host pointer used by member functions, so
+ * the default is the size of a pointer and a functor is as large as two
+ * pointers. That is enough for a lambda capturing one reference or pointer.
+ * Define this macro before including this file to change the default value.
+ * Larger values make every functor, and every event, grow.
+ * @since 1.2
+ * @ingroup sstl_functors
+ **/
+#ifndef SSTL_FUNCTOR_INLINE_SIZE
+#define SSTL_FUNCTOR_INLINE_SIZE        (sizeof(void *))
+#endif
+/*}}}*/
+
+// #define SSTL_CONSTEXPR14/*{{{*/
+/**
+ * Expands to `constexpr` when the compiler supports C++14 relaxed constant
+ * expressions. Used on functions that change the object state, like
+ * `ss::FunctorT::bind()`, which cannot be `constexpr` in C++11.
+ * @since 1.2
+ * @ingroup sstl_functors
+ **/
+#if (__cplusplus >= 201402L) || (defined(_MSC_VER) && (_MSC_VER >= 1910))
+#define SSTL_CONSTEXPR14                constexpr
+#else
+#define SSTL_CONSTEXPR14
+#endif
+/*}}}*/
+
+namespace sstl {
+
+/**
+ * Compile time list of indexes.
+ * Used to expand the elements of a `std::tuple` in a function call.
+ * @since 1.2
+ **/
+template <size_t... _Index> struct IndexesT { };
+
+/**
+ * Builds an `sstl::IndexesT` type with the indexes from 0 to \a _Count - 1.
+ * @since 1.2
+ **/
+template <size_t _Count, size_t... _Index>
+struct MakeIndexesT : MakeIndexesT<_Count - 1, _Count - 1, _Index...> { };
+
+/**
+ * Builds an `sstl::IndexesT` type with the indexes from 0 to \a _Count - 1.
+ * Stop condition.
+ * @since 1.2
+ **/
+template <size_t... _Index>
+struct MakeIndexesT<0, _Index...> {
+    typedef IndexesT<_Index...> type;
+};
+
+/**
+ * Maps any list of types to `void`.
+ * Used to detect valid expressions in partial specializations.
+ * @since 1.2
+ **/
+template <typename... _Types> struct VoidT { typedef void type; };
+
+/**
+ * Checks whether a callable object can be stored in an `ss::FunctorT`.
+ * @tparam _Callable_t Type of the callable object.
+ * @tparam _Signature_t Signature of the functor.
+ * @remarks `value` is \b true when the callable can be invoked, as a `const`
+ * object, with the parameters of the signature, returns something
+ * convertible to the functor return type and fits the inline storage: not
+ * larger than `SSTL_FUNCTOR_INLINE_SIZE`, not aligned beyond a pointer,
+ * trivially copyable and trivially destructible.
+ * @since 1.2
+ **/
+template <class _Callable_t, typename _Signature_t, class = void>
+struct CallableT : std::false_type { };
+
+/**
+ * Checks whether a callable object can be stored in an `ss::FunctorT`.
+ * Specialization selected when the callable can be invoked with the
+ * parameters of the signature.
+ * @since 1.2
+ **/
+template <class _Callable_t, typename _Return_t, typename... _Args_t>
+struct CallableT<_Callable_t, _Return_t (_Args_t...), typename VoidT<
+    decltype(std::declval<const _Callable_t&>()(std::declval<_Args_t>()...))>::type> :
+    std::integral_constant<bool,
+        (std::is_void<_Return_t>::value ||
+         std::is_convertible<decltype(std::declval<const _Callable_t&>()(std::declval<_Args_t>()...)),
+                             _Return_t>::value) &&
+        (sizeof(_Callable_t) <= SSTL_FUNCTOR_INLINE_SIZE) &&
+        (alignof(_Callable_t) <= alignof(void *)) &&
+        std::is_trivially_copyable<_Callable_t>::value &&
+        std::is_trivially_destructible<_Callable_t>::value> { };
+
+}   /* namespace sstl */
+
 namespace ss {
 
 /**
  * Super Simple Functor class template.
  * This class is a basic implementation of a Functor class. It can be used to
  * pass pointers to member functions to be called from another unknown source.
- * It was designed to support C++ 98 compilers, thus, doens't support variadic
- * templates nor `std::forward` technique.
+ * A single variadic implementation handles functions with any number of
+ * parameters. Arguments are perfectly forwarded through the call chain so,
+ * when the signature has parameters passed by value, they are copied only
+ * once: when the bound function is called.
  * @tparam signature_t The function signature. Examples are:
  * - `void(int)`: Function returning void with an \b int parameter.
  * - `int(const std::string&)`: Function returning \b int with a reference to
@@ -44,46 +155,85 @@ namespace ss {
  ~~~~~~~~~~~~~~~~~~~~~
  * Now every time you write `aFunctionFunctor()` the `MyObject::aFunction()`
  * will be called and the same happens with `anotherFunctionFunctor`.
+ *
+ * Free functions, captureless lambdas and small lambdas with captures can
+ * also be bound. They are copied into an inline buffer with
+ * `SSTL_FUNCTOR_INLINE_SIZE` bytes, so no memory is allocated:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * int total = 0;
+ * ss::FunctorT<void(int)> accumulate([&total](int value) { total += value; });
+ * ss::FunctorT<double(double)> root(&sqrt);   // ::sqrt from <math.h>
+ ~~~~~~~~~~~~~~~~~~~~~
+ * Bound callables must be trivially copyable and trivially destructible.
+ * This keeps the functor a plain value that can be copied as the member
+ * function pointer version. A lambda capturing a `std::string` by value, for
+ * example, is refused at compile time.
+ *
+ * Every %FunctorT type is trivially copyable and trivially destructible. It
+ * can be copied with `memcpy()` into shared memory or lock free queues. The
+ * default constructor and `from()` are `constexpr`, so tables of functors
+ * bound to member functions can be built at compile time:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * static MyObject object;
+ * static constexpr ss::FunctorT<int(int)> table[] = {
+ *     ss::FunctorT<int(int)>::from<MyObject, &MyObject::aFunction>(&object),
+ *     ss::FunctorT<int(int)>()
+ * };
+ ~~~~~~~~~~~~~~~~~~~~~
+ * `bind()` is also `constexpr` when compiled as C++14 or newer.
  * @since 1.0
  * @ingroup sstl_functors
  **/
 template <typename signature_t> class FunctorT;
 
 /**
- * Functor for functions with 3 parameters.
+ * Functor for functions with any number of parameters.
  * This specialization is selected when bind functions that have a return
- * value and three parameter. The return value can be `void`.
+ * value and zero or more parameters. The return value can be `void`.
  * @tparam _Return_t Type of return value of the function to be called.
- * @tparam _Param1_t Type of the first parameter of the function.
- * @tparam _Param2_t Type of the second parameter of the function.
- * @tparam _Param3_t Type of the third parameter of the function.
- * @since 1.1
+ * @tparam _Args_t Types of the parameters of the function.
+ * @since 1.2
  * @ingroup sstl_functors
  *//* --------------------------------------------------------------------- */
-template <typename _Return_t, typename _Param1_t, typename _Param2_t, typename _Param3_t>
-class FunctorT<_Return_t (_Param1_t, _Param2_t, _Param3_t)>
+template <typename _Return_t, typename... _Args_t>
+class FunctorT<_Return_t (_Args_t...)>
 {
 public:
     /** Typedef's the function signature. */
-    typedef _Return_t (*signature)(_Param1_t, _Param2_t, _Param3_t);
+    typedef _Return_t (*signature)(_Args_t...);
 
     /** @name Constructors & Destructors */ //@{
     // FunctorT() { }/*{{{*/
     /**
      * Default constructor.
      * Builds an empty functor object.
-     * @since 1.1
+     * @remarks The copy constructor and the copy operator are the ones
+     * generated by the compiler, thus trivial.
+     * @since 1.0
      **/
-    FunctorT() : m_host(NULL), m_call(NULL) { }
+    constexpr FunctorT() noexcept : m_data{ NULL }, m_call(NULL) {
+        static_assert(std::is_trivially_copyable<FunctorT>::value &&
+                      std::is_trivially_destructible<FunctorT>::value,
+                      "ss::FunctorT must be trivially copyable");
+    }
     /*}}}*/
-    // FunctorT(const FunctorT<_Return_t (_Param1_t, _Param2_t, _Param3_t)> &other) { }/*{{{*/
+    // FunctorT(_Callable_t fn) { }/*{{{*/
     /**
-     * Copy constructor.
-     * @param other Another instance to copy its information.
-     * @since 1.1
+     * Builds a functor bound to a callable object.
+     * @tparam _Callable_t Type of the callable object. Can be a pointer to a
+     * free function or a lambda. Must be trivially copyable, trivially
+     * destructible and not larger than `SSTL_FUNCTOR_INLINE_SIZE`.
+     * @param fn The callable object. It is copied into this functor.
+     * @remarks This constructor takes part in overload resolution only when
+     * `sstl::CallableT` accepts the callable. So other types are not
+     * implicitly converted to a functor.
+     * @since 1.2
      **/
-    FunctorT(const FunctorT<_Return_t (_Param1_t, _Param2_t, _Param3_t)> &other) :
-        m_host(other.m_host), m_call(other.m_call) { }
+    template <class _Callable_t, class = typename std::enable_if<
+        sstl::CallableT<_Callable_t, _Return_t (_Args_t...)>::value>::type>
+    FunctorT(_Callable_t fn) noexcept : m_data{ NULL }, m_call(NULL) {
+        bind(fn);
+    }
     /*}}}*/
     //@}
 
@@ -105,17 +255,17 @@ public:
      ~~~~~~~~~~~~~~~~~~~~~{.cpp}
      * class SomeObject
      * {
-     *     void fun(int data, int other, bool another);
+     *     void fun(int data);
      * };
      *
      * SomeObject object;
-     * ss::FunctorT<void(int, int, bool)> myFunctor;
-     * myFunctor = ss::FunctorT<void(int, int, bool)>::from<SomeObject, SomeObject::fun>(&object);
+     * ss::FunctorT<void(int)> myFunctor;
+     * myFunctor = ss::FunctorT<void(int)>::from<SomeObject, SomeObject::fun>(&object);
      ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.1
+     * @since 1.0
      **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Param1_t, _Param2_t, _Param3_t)>
-    static FunctorT from(_Host_t *host) {
+    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Args_t...)>
+    static constexpr FunctorT from(_Host_t *host) noexcept {
         return FunctorT(host, &invoker<_Host_t, _Method>);
     }
     /*}}}*/
@@ -136,20 +286,37 @@ public:
      ~~~~~~~~~~~~~~~~~~~~~{.cpp}
      * class SomeObject
      * {
-     *     void fun(int data, int other, bool other) const;
+     *     void fun(int data) const;
      * };
      *
      * SomeObject object;
-     * ss::FunctorT<void(int, int, bool)> myFunctor;
-     * myFunctor = ss::FunctorT<void(int, int, bool)>::from<SomeObject, SomeObject::fun>(&object);
+     * ss::FunctorT<void(int)> myFunctor;
+     * myFunctor = ss::FunctorT<void(int)>::from<SomeObject, SomeObject::fun>(&object);
      ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.1
+     * @since 1.0
      **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Param1_t, _Param2_t, _Param3_t) const>
-    static FunctorT from(_Host_t const *host) {
+    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Args_t...) const>
+    static constexpr FunctorT from(_Host_t const *host) noexcept {
         return FunctorT(const_cast<_Host_t*>(host), &const_invoker<_Host_t, _Method>);
     }
     /*}}}*/
+    // static FunctorT from(_Callable_t fn) { }/*{{{*/
+    /**
+     * Creates an ss::FunctorT instance bound to a callable object.
+     * @tparam _Callable_t Type of the callable object. Can be a pointer to a
+     * free function or a lambda. Must be trivially copyable, trivially
+     * destructible and not larger than `SSTL_FUNCTOR_INLINE_SIZE`.
+     * @param fn The callable object. It is copied into the returned functor.
+     * @return A new instance of an `ss::FunctorT` object.
+     * @since 1.2
+     **/
+    template <class _Callable_t>
+    static FunctorT from(_Callable_t fn) noexcept {
+        FunctorT functor;
+        functor.bind(fn);
+        return functor;
+    }
+    /*}}}*/
 
     /** @name Attributes */ //@{
     // bool isHost(void *ptr) const { }/*{{{*/
@@ -158,24 +325,55 @@ public:
      * @param ptr Pointer to the instance of the host object.
      * @return \b true if the specified address is the same as the host
      * pointed by this object. \b false otherwise.
-     * @since 1.1
+     * @remarks See `host()` for functors bound to callable objects.
+     * @since 1.0
      **/
-    bool isHost(void *ptr) const {
-        return (m_host == ptr);
+    constexpr bool isHost(void *ptr) const noexcept {
+        return (m_data[0] == ptr);
     }
     /*}}}*/
     // bool valid() const { }/*{{{*/
     /**
      * Checks whether this object is valid.
      * @returns \b true if this object was bound to a host class and member
-     * function. \b false otherwise.
+     * function or to a callable object. \b false otherwise.
      * @note This function doesn't valid the target object and member
      * function. Only checks whether this functor was bound. The host object
      * must be valid until this functor is destroyed.
-     * @since 1.1
+     * @since 1.0
+     **/
+    constexpr bool valid() const noexcept {
+        return (m_call != NULL);
+    }
+    /*}}}*/
+    // void* host() const { }/*{{{*/
+    /**
+     * Retrieves the pointer to the host object.
+     * @returns The address of the host object or \b NULL when this functor
+     * was not bound.
+     * @remarks The host pointer shares its storage with callable objects.
+     * For a functor bound to a callable this is its first pointer sized
+     * word, usually the first captured pointer. So removing the delegates of
+     * an object from an event also removes the lambdas that captured that
+     * object first.
+     * @since 1.2
+     **/
+    constexpr void* host() const noexcept {
+        return m_data[0];
+    }
+    /*}}}*/
+    // size_t hash() const { }/*{{{*/
+    /**
+     * Computes a hash value for this functor.
+     * @returns A value combining the host object address (or the first
+     * bytes of the bound callable) and the invoker function of this functor.
+     * Functors that compare equal have the same hash value.
+     * @since 1.2
      **/
-    bool valid() const {
-        return ((m_host != NULL) && (m_call != NULL));
+    size_t hash() const noexcept {
+        size_t h = reinterpret_cast<size_t>(m_data[0]);
+        size_t c = reinterpret_cast<size_t>(m_call);
+        return (h ^ (h >> 4) ^ (c * 31) ^ (c >> 3));
     }
     /*}}}*/
     //@}
@@ -197,19 +395,18 @@ public:
      ~~~~~~~~~~~~~~~~~~~~~{.cpp}
      * class SomeObject
      * {
-     *     void fun(int data, int other, bool other);
+     *     void fun(int data);
      * };
      *
      * SomeObject object;
-     * ss::FunctorT<void(int, int, bool)> myFunctor;
+     * ss::FunctorT<void(int)> myFunctor;
      * myFunctor.bind<SomeObject, SomeObject::fun>(&object);
      ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.1
+     * @since 1.0
      **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Param1_t, _Param2_t, _Param3_t)>
-    void bind(_Host_t *host) {
-        m_host = (void *)host;
-        m_call = &invoker<_Host_t, _Method>;
+    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Args_t...)>
+    SSTL_CONSTEXPR14 void bind(_Host_t *host) noexcept {
+        *this = FunctorT((void *)host, &invoker<_Host_t, _Method>);
     }
     /*}}}*/
     // void bind(_Host_t const *host) { }/*{{{*/
@@ -228,65 +425,99 @@ public:
      ~~~~~~~~~~~~~~~~~~~~~{.cpp}
      * class SomeObject
      * {
-     *     void fun(int data, int other, bool other);
+     *     void fun(int data) const;
      * };
      *
      * SomeObject object;
-     * ss::FunctorT<void(int, int, bool)> myFunctor;
+     * ss::FunctorT<void(int)> myFunctor;
      * myFunctor.bind<SomeObject, SomeObject::fun>(&object);
      ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.1
+     * @since 1.0
+     **/
+    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Args_t...) const>
+    SSTL_CONSTEXPR14 void bind(_Host_t const *host) noexcept {
+        *this = FunctorT((void *)const_cast<_Host_t *>(host), &const_invoker<_Host_t, _Method>);
+    }
+    /*}}}*/
+    // void bind(_Callable_t fn) { }/*{{{*/
+    /**
+     * Binds a functor with a callable object.
+     * @tparam _Callable_t Type of the callable object. Can be a pointer to a
+     * free function or a lambda. Must be trivially copyable, trivially
+     * destructible and not larger than `SSTL_FUNCTOR_INLINE_SIZE`. The
+     * compiler deduces it from the function parameter.
+     * @param fn The callable object. It is copied into this functor. Passing
+     * a \b NULL function pointer leaves the functor empty.
+     * @remarks The callable is invoked as a `const` object, so `mutable`
+     * lambdas are not supported.
+     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * SomeObject object;
+     * ss::FunctorT<void(int)> myFunctor;
+     * myFunctor.bind([&object](int data) { object.fun(data * 2); });
+     ~~~~~~~~~~~~~~~~~~~~~
+     * @since 1.2
      **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Param1_t, _Param2_t, _Param3_t) const>
-    void bind(_Host_t const *host) {
-        m_host = (void *)const_cast<_Host_t *>(host);
-        m_call = &const_invoker<_Host_t, _Method>;
+    template <class _Callable_t>
+    void bind(_Callable_t fn) noexcept {
+        static_assert(sizeof(_Callable_t) <= SSTL_FUNCTOR_INLINE_SIZE,
+                      "callable too large for ss::FunctorT, see SSTL_FUNCTOR_INLINE_SIZE");
+        static_assert(alignof(_Callable_t) <= alignof(void *),
+                      "callable alignment not supported by ss::FunctorT");
+        static_assert(std::is_trivially_copyable<_Callable_t>::value &&
+                      std::is_trivially_destructible<_Callable_t>::value,
+                      "ss::FunctorT only stores trivially copyable callables");
+
+        std::memset(m_data, 0, sizeof(m_data));
+        std::memcpy(m_data, &fn, sizeof(_Callable_t));
+        m_call = (empty(fn) ? NULL : &callable_invoker<_Callable_t>);
     }
     /*}}}*/
-    // _Return_t exec(_Param1_t param1, _Param2_t param2, _Param3_t param3) const { }/*{{{*/
+    // _Return_t exec(_Params_t&&... params) const { }/*{{{*/
     /**
      * Calls the pointer to member function bound to this object.
-     * @param param1 First paramter to pass to the function.
-     * @param param2 Second parameter to pass to the function.
-     * @param param3 Third parameter to pass to the function.
+     * @param params Parameters to pass to the function. They are forwarded
+     * as they were received, so no copy is done here.
      * @return The value returned by the called function.
-     * @note If no function was bound to this object the behavior is
-     * undefined.
-     * @since 1.1
+     * @note If no function was bound to this object a default constructed
+     * value is returned.
+     * @remarks This function is not `noexcept`. Exceptions thrown by the
+     * bound function are propagated to the caller. Some events rely on
+     * that to keep their state consistent.
+     * @since 1.0
      **/
-    _Return_t exec(_Param1_t param1, _Param2_t param2, _Param3_t param3) const {
-        if (!m_call) return (_Return_t)0;
-        return (*m_call)(m_host, param1, param2, param3);
+    template <typename... _Params_t>
+    _Return_t exec(_Params_t&&... params) const {
+        if (!m_call) return _Return_t();
+        return (*m_call)(*this, std::forward<_Params_t>(params)...);
     }
     /*}}}*/
     //@}
 
     /** @name Overloaded Operators */ //@{
-    // _Return_t operator ()(_Param1_t param1, _Param2_t param2, _Param3_t param3) const { }/*{{{*/
+    // _Return_t operator ()(_Params_t&&... params) const { }/*{{{*/
     /**
      * Call the member function pointed to this object.
-     * @param param1 First parameter to pass to the function.
-     * @param param2 Second parameter to pass to the function.
-     * @param param3 Second parameter to pass to the function.
+     * @param params Parameters to pass to the function.
      * @return The value returned by the called function.
-     * @note If no function was bound to this object the behavior is
-     * undefined.
-     * @since 1.1
+     * @note If no function was bound to this object a default constructed
+     * value is returned.
+     * @since 1.0
      **/
-    _Return_t operator ()(_Param1_t param1, _Param2_t param2, _Param3_t param3) const {
-        return exec(param1, param2, param3);
+    template <typename... _Params_t>
+    _Return_t operator ()(_Params_t&&... params) const {
+        return exec(std::forward<_Params_t>(params)...);
     }
     /*}}}*/
     // operator bool() const { }/*{{{*/
     /**
      * Casting to \b bool operator.
      * Checks the validity of this functor object.
-     * @return \b true when the object points to a function and its host. \b
-     * false otherwise.
-     * @since 1.1
+     * @return \b true when the object points to a function and its host, or
+     * to a callable object. \b false otherwise.
+     * @since 1.0
      **/
-    operator bool() const {
-        return (m_host && m_call);
+    constexpr operator bool() const noexcept {
+        return (m_call != NULL);
     }
     /*}}}*/
     // bool operator !() const { }/*{{{*/
@@ -295,42 +526,43 @@ public:
      * Check if this object is invalid. Invalid objects have not been bound to
      * a function or object.
      * @returns \b true when this object is invalid. \b false otherwise.
-     * @since 1.1
+     * @since 1.0
      **/
-    bool operator !() const {
-        return (m_host == NULL || m_call == NULL);
+    constexpr bool operator !() const noexcept {
+        return (m_call == NULL);
     }
     /*}}}*/
-    // bool operator ==(const FunctorT<_Return_t (_Param1_t, _Param2_t, _Param3_t)> &other) const;/*{{{*/
+    // bool operator ==(const FunctorT<_Return_t (_Args_t...)> &other) const;/*{{{*/
     /**
      * Comparison operator.
      * @param other Another instance to compare with.
      * @return \b true if both instances points to the same host and function.
      * \b false otherwise.
-     * @since 1.1
-     **/
-    bool operator ==(const FunctorT<_Return_t (_Param1_t, _Param2_t, _Param3_t)> &other) const {
-        return ((m_host == other.m_host) && (m_call == other.m_call));
-    }
-    /*}}}*/
-    // FunctorT& operator =(const FunctorT<_Return_t (_Param1_t, _Param2_t, _Param3_t)> &other) { }/*{{{*/
-    /**
-     * Copy operator.
-     * @param other Another instance to copy its information.
-     * @return A reference to \b this instance.
-     * @since 1.1
+     * @remarks Functors bound to callable objects are equal when they hold
+     * objects of the same type with the same bytes. Copies of a lambda are
+     * equal. Two lambdas written apart are never equal, even when they have
+     * the same body.
+     * @since 1.0
      **/
-    FunctorT& operator =(const FunctorT<_Return_t (_Param1_t, _Param2_t, _Param3_t)> &other) {
-        m_host = other.m_host;
-        m_call = other.m_call;
-        return *this;
+    bool operator ==(const FunctorT<_Return_t (_Args_t...)> &other) const noexcept {
+        return ((m_call == other.m_call) &&
+                (std::memcmp(m_data, other.m_data, sizeof(m_data)) == 0));
     }
     /*}}}*/
     //@}
 
 private:
-    /** Type of the invoker function. */
-    typedef _Return_t (*invoker_t)(void*, _Param1_t, _Param2_t, _Param3_t);
+    /**
+     * Type of the invoker function.
+     * Parameters passed by value in the signature are received by value
+     * here and moved to the called function.
+     **/
+    typedef _Return_t (*invoker_t)(const FunctorT&, _Args_t...);
+
+    /** Number of pointers in the inline storage. */
+    enum { words = (SSTL_FUNCTOR_INLINE_SIZE + sizeof(void *) - 1) / sizeof(void *) };
+    static_assert(SSTL_FUNCTOR_INLINE_SIZE >= sizeof(void *),
+                  "SSTL_FUNCTOR_INLINE_SIZE must hold at least a pointer");
 
     /** @name Constructors */ //@{
     // FunctorT(void *host, invoker_t caller) { }/*{{{*/
@@ -341,1052 +573,90 @@ private:
      * @param host The host object to call.
      * @param caller Pointer to the static function that does call the member
      * function of \a host.
-     * @since 1.1
+     * @since 1.0
      **/
-    FunctorT(void *host, invoker_t caller) : m_host(host), m_call(caller) { }
+    constexpr FunctorT(void *host, invoker_t caller) noexcept :
+        m_data{ host }, m_call(host ? caller : NULL) { }
     /*}}}*/
     //@}
 
     // Static Functions
-    // static _Return_t invoker(void *host, _Param1_t param1, _Param2_t param2, _Param3_t param3) { }/*{{{*/
+    // static bool empty(_Callable_t fn) { }/*{{{*/
+    /**
+     * Checks whether a callable object is a \b NULL function pointer.
+     * @since 1.2
+     **/
+    template <class _Callable_t>
+    static constexpr bool empty(const _Callable_t &) noexcept { return false; }
+    template <class _Result_t, typename... _Params_t>
+    static constexpr bool empty(_Result_t (*fn)(_Params_t...)) noexcept { return (fn == NULL); }
+    /*}}}*/
+
+    // static _Return_t invoker(const FunctorT &self, _Args_t... args) { }/*{{{*/
     /**
      * Calls the function pointed by the object instance.
      * @tparam _Host_t The type of the host object.
      * @tparam _Member Pointer to member function.
-     * @param host The address of the host object.
-     * @param param1 First parameter to pass to the function.
-     * @param param2 Second parameter to pass to the function.
-     * @param param3 Third parameter to pass to the function.
+     * @param self The functor holding the address of the host object.
+     * @param args Parameters to pass to the function.
      * @return The same result as the function to be called.
-     * @since 1.1
+     * @since 1.0
      **/
-    template <class _Host_t, _Return_t (_Host_t::*_Member)(_Param1_t, _Param2_t, _Param3_t)>
-    static _Return_t invoker(void *host, _Param1_t param1, _Param2_t param2, _Param3_t param3) {
-        _Host_t *p = static_cast<_Host_t *>(host);
-        return (p->*_Member)(param1, param2, param3);
+    template <class _Host_t, _Return_t (_Host_t::*_Member)(_Args_t...)>
+    static _Return_t invoker(const FunctorT &self, _Args_t... args) {
+        _Host_t *p = static_cast<_Host_t *>(self.m_data[0]);
+        return (p->*_Member)(std::forward<_Args_t>(args)...);
     }
     /*}}}*/
-    // static _Return_t const_invoker(void *host, _Param1_t param1, _Param2_t param2, _Param3_t param3) { }/*{{{*/
+    // static _Return_t const_invoker(const FunctorT &self, _Args_t... args) { }/*{{{*/
     /**
      * Calls the function pointed by the object instance.
      * This implementation is used to support const cv-qualified objects.
      * @tparam _Host_t The type of the host object.
      * @tparam _Member Pointer to member function.
-     * @param host The address of the host object.
-     * @param param1 First value to pass to the function.
-     * @param param2 Second value to pass to the function.
-     * @param param3 Third value to pass to the function.
+     * @param self The functor holding the address of the host object.
+     * @param args Parameters to pass to the function.
      * @return The same result as the function to be called.
-     * @since 1.1
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Member)(_Param1_t, _Param2_t, _Param3_t) const>
-    static _Return_t const_invoker(void *host, _Param1_t param1, _Param2_t param2, _Param3_t param3) {
-        _Host_t const *p = static_cast<_Host_t *>(host);
-        return (p->*_Member)(param1, param2, param3);
-    }
-    /*}}}*/
-
-    // Data Members
-    void *m_host;               /**< Pointer to the host object instance. */
-    invoker_t m_call;           /**< Pointer to the invoker function.     */
-};
-
-/**
- * Functor for functions with 2 parameters.
- * This specialization is selected when bind functions that have a return
- * value and two parameter. The return value can be `void`.
- * @tparam _Return_t Type of return value of the function to be called.
- * @tparam _Param1_t Type of the first parameter of the function.
- * @tparam _Param2_t Type of the second parameter of the function.
- * @since 1.0
- * @ingroup sstl_functors
- *//* --------------------------------------------------------------------- */
-template <typename _Return_t, typename _Param1_t, typename _Param2_t>
-class FunctorT<_Return_t (_Param1_t, _Param2_t)>
-{
-public:
-    /** Typedef's the function signature. */
-    typedef _Return_t (*signature)(_Param1_t, _Param2_t);
-
-    /** @name Constructors & Destructors */ //@{
-    // FunctorT() { }/*{{{*/
-    /**
-     * Default constructor.
-     * Builds an empty functor object.
-     * @since 1.0
-     **/
-    FunctorT() : m_host(NULL), m_call(NULL) { }
-    /*}}}*/
-    // FunctorT(const FunctorT<_Return_t (_Param1_t, _Param2_t)> &other) { }/*{{{*/
-    /**
-     * Copy constructor.
-     * @param other Another instance to copy its information.
-     * @since 1.0
-     **/
-    FunctorT(const FunctorT<_Return_t (_Param1_t, _Param2_t)> &other) :
-        m_host(other.m_host), m_call(other.m_call) { }
-    /*}}}*/
-    //@}
-
-    // Static Functions
-    // static FunctorT from(_Host_t *host) { }/*{{{*/
-    /**
-     * Creates an ss::FunctorT instance bound to a pointer to member function.
-     * @tparam _Host_t Type of the host object. The object that declares the
-     * function to be called.
-     * @tparam _Method Pointer to the member function to be called.
-     * @param host Pointer to the instance of the object where the pointer to
-     * member function should be invoked.
-     * @return A new instance of an `ss::FunctorT` object.
-     * @remarks This function must be called on a declaration of a %FunctorT
-     * type. For example, suppose you have an object that declares a function
-     * returning `void` with an `int` parameter. You declare the functor type
-     * and call this function passing the pointer to member function as
-     * template parameter.
-     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
-     * class SomeObject
-     * {
-     *     void fun(int data, bool another);
-     * };
-     *
-     * SomeObject object;
-     * ss::FunctorT<void(int, bool)> myFunctor;
-     * myFunctor = ss::FunctorT<void(int, bool)>::from<SomeObject, SomeObject::fun>(&object);
-     ~~~~~~~~~~~~~~~~~~~~~
      * @since 1.0
      **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Param1_t, _Param2_t)>
-    static FunctorT from(_Host_t *host) {
-        return FunctorT(host, &invoker<_Host_t, _Method>);
+    template <class _Host_t, _Return_t (_Host_t::*_Member)(_Args_t...) const>
+    static _Return_t const_invoker(const FunctorT &self, _Args_t... args) {
+        _Host_t const *p = static_cast<_Host_t *>(self.m_data[0]);
+        return (p->*_Member)(std::forward<_Args_t>(args)...);
     }
     /*}}}*/
-    // static FunctorT from(_Host_t const *host) { }/*{{{*/
+    // static _Return_t callable_invoker(const FunctorT &self, _Args_t... args) { }/*{{{*/
     /**
-     * Overload used on a const pointer to member function.
-     * @tparam _Host_t Type of the host object. The object that declares the
-     * function to be called.
-     * @tparam _Method Pointer to the member function to be called.
-     * @param host Pointer to the instance of the object where the pointer to
-     * member function should be invoked.
-     * @return A new instance of an `ss::FunctorT` object.
-     * @remarks This function must be called on a declaration of a %FunctorT
-     * type. For example, suppose you have an object that declares a function
-     * returning `void` with an `int` parameter. You declare the functor type
-     * and call this function passing the pointer to member function as
-     * template parameter.
-     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
-     * class SomeObject
-     * {
-     *     void fun(int data, bool other) const;
-     * };
-     *
-     * SomeObject object;
-     * ss::FunctorT<void(int, bool)> myFunctor;
-     * myFunctor = ss::FunctorT<void(int, bool)>::from<SomeObject, SomeObject::fun>(&object);
-     ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.0
+     * Calls the callable object stored in the functor.
+     * @tparam _Callable_t The type of the callable object.
+     * @param self The functor holding the callable object.
+     * @param args Parameters to pass to the callable.
+     * @return The same result as the callable object.
+     * @since 1.2
      **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Param1_t, _Param2_t) const>
-    static FunctorT from(_Host_t const *host) {
-        return FunctorT(const_cast<_Host_t*>(host), &const_invoker<_Host_t, _Method>);
+    template <class _Callable_t>
+    static _Return_t callable_invoker(const FunctorT &self, _Args_t... args) {
+        const _Callable_t *fn = reinterpret_cast<const _Callable_t *>(self.m_data);
+        return static_cast<_Return_t>((*fn)(std::forward<_Args_t>(args)...));
     }
     /*}}}*/
 
-    /** @name Attributes */ //@{
-    // bool isHost(void *ptr) const { }/*{{{*/
-    /**
-     * Checks whether this object instance points to the specified host.
-     * @param ptr Pointer to the instance of the host object.
-     * @return \b true if the specified address is the same as the host
-     * pointed by this object. \b false otherwise.
-     * @since 1.0
-     **/
-    bool isHost(void *ptr) const {
-        return (m_host == ptr);
-    }
-    /*}}}*/
-    // bool valid() const { }/*{{{*/
-    /**
-     * Checks whether this object is valid.
-     * @returns \b true if this object was bound to a host class and member
-     * function. \b false otherwise.
-     * @note This function doesn't valid the target object and member
-     * function. Only checks whether this functor was bound. The host object
-     * must be valid until this functor is destroyed.
-     * @since 1.0
-     **/
-    bool valid() const {
-        return ((m_host != NULL) && (m_call != NULL));
-    }
-    /*}}}*/
-    //@}
+    // Data Members
+    void *m_data[words];        /**< Host object or callable storage.     */
+    invoker_t m_call;           /**< Pointer to the invoker function.     */
+};
 
-    /** @name Operations */ //@{
-    // void bind(_Host_t *host) { }/*{{{*/
-    /**
-     * Binds a functor with a pointer to member function.
-     * @tparam _Host_t Type of the host object. The object that declares the
-     * function to be called.
-     * @tparam _Method Pointer to the member function to be called.
-     * @param host Pointer to the instance of the object where the pointer to
-     * member function should be invoked.
-     * @remarks This function must be called on a declaration of a %FunctorT
-     * type. For example, suppose you have an object that declares a function
-     * returning `void` with an `int` parameter. You declare the functor type
-     * and call this function passing the pointer to member function as
-     * template parameter.
-     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
-     * class SomeObject
-     * {
-     *     void fun(int data, bool other);
-     * };
-     *
-     * SomeObject object;
-     * ss::FunctorT<void(int, bool)> myFunctor;
-     * myFunctor.bind<SomeObject, SomeObject::fun>(&object);
-     ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Param1_t, _Param2_t)>
-    void bind(_Host_t *host) {
-        m_host = (void *)host;
-        m_call = &invoker<_Host_t, _Method>;
-    }
-    /*}}}*/
-    // void bind(_Host_t const *host) { }/*{{{*/
-    /**
-     * Overload used on a const pointer to member function.
-     * @tparam _Host_t Type of the host object. The object that declares the
-     * function to be called.
-     * @tparam _Method Pointer to the member function to be called.
-     * @param host Pointer to the instance of the object where the pointer to
-     * member function should be invoked.
-     * @remarks This function must be called on a declaration of a %FunctorT
-     * type. For example, suppose you have an object that declares a function
-     * returning `void` with an `int` parameter. You declare the functor type
-     * and call this function passing the pointer to member function as
-     * template parameter.
-     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
-     * class SomeObject
-     * {
-     *     void fun(int data, bool other);
-     * };
-     *
-     * SomeObject object;
-     * ss::FunctorT<void(int, bool)> myFunctor;
-     * myFunctor.bind<SomeObject, SomeObject::fun>(&object);
-     ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Param1_t, _Param2_t) const>
-    void bind(_Host_t const *host) {
-        m_host = (void *)const_cast<_Host_t *>(host);
-        m_call = &const_invoker<_Host_t, _Method>;
-    }
-    /*}}}*/
-    // _Return_t exec(_Param1_t param1, _Param2_t param2) const { }/*{{{*/
-    /**
-     * Calls the pointer to member function bound to this object.
-     * @param param1 First paramter to pass to the function.
-     * @param param2 Second parameter to pass to the function.
-     * @return The value returned by the called function.
-     * @note If no function was bound to this object the behavior is
-     * undefined.
-     * @since 1.0
-     **/
-    _Return_t exec(_Param1_t param1, _Param2_t param2) const {
-        if (!m_call) return (_Return_t)0;
-        return (*m_call)(m_host, param1, param2);
-    }
-    /*}}}*/
-    //@}
-
-    /** @name Overloaded Operators */ //@{
-    // _Return_t operator ()(_Param1_t param1, _Param2_t param2) const { }/*{{{*/
-    /**
-     * Call the member function pointed to this object.
-     * @param param1 First parameter to pass to the function.
-     * @param param2 Second parameter to pass to the function.
-     * @return The value returned by the called function.
-     * @note If no function was bound to this object the behavior is
-     * undefined.
-     * @since 1.0
-     **/
-    _Return_t operator ()(_Param1_t param1, _Param2_t param2) const {
-        return exec(param1, param2);
-    }
-    /*}}}*/
-    // operator bool() const { }/*{{{*/
-    /**
-     * Casting to \b bool operator.
-     * Checks the validity of this functor object.
-     * @return \b true when the object points to a function and its host. \b
-     * false otherwise.
-     * @since 1.0
-     **/
-    operator bool() const {
-        return (m_host && m_call);
-    }
-    /*}}}*/
-    // bool operator !() const { }/*{{{*/
-    /**
-     * Negation operator.
-     * Check if this object is invalid. Invalid objects have not been bound to
-     * a function or object.
-     * @returns \b true when this object is invalid. \b false otherwise.
-     * @since 1.0
-     **/
-    bool operator !() const {
-        return (m_host == NULL || m_call == NULL);
-    }
-    /*}}}*/
-    // bool operator ==(const FunctorT<_Return_t (_Param1_t, _Param2_t)> &other) const;/*{{{*/
-    /**
-     * Comparison operator.
-     * @param other Another instance to compare with.
-     * @return \b true if both instances points to the same host and function.
-     * \b false otherwise.
-     * @since 1.0
-     **/
-    bool operator ==(const FunctorT<_Return_t (_Param1_t, _Param2_t)> &other) const {
-        return ((m_host == other.m_host) && (m_call == other.m_call));
-    }
-    /*}}}*/
-    // FunctorT& operator =(const FunctorT<_Return_t (_Param1_t, _Param2_t)> &other) { }/*{{{*/
-    /**
-     * Copy operator.
-     * @param other Another instance to copy its information.
-     * @return A reference to \b this instance.
-     * @since 1.0
-     **/
-    FunctorT& operator =(const FunctorT<_Return_t (_Param1_t, _Param2_t)> &other) {
-        m_host = other.m_host;
-        m_call = other.m_call;
-        return *this;
-    }
-    /*}}}*/
-    //@}
-
-private:
-    /** Type of the invoker function. */
-    typedef _Return_t (*invoker_t)(void*, _Param1_t, _Param2_t);
-
-    /** @name Constructors */ //@{
-    // FunctorT(void *host, invoker_t caller) { }/*{{{*/
-    /**
-     * Parametrized constructor.
-     * Builds an instance defining the host object and the invoker function
-     * used to call the pointer to member of host.
-     * @param host The host object to call.
-     * @param caller Pointer to the static function that does call the member
-     * function of \a host.
-     * @since 1.0
-     **/
-    FunctorT(void *host, invoker_t caller) : m_host(host), m_call(caller) { }
-    /*}}}*/
-    //@}
-
-    // Static Functions
-    // static _Return_t invoker(void *host, _Param1_t param1, _Param2_t param2) { }/*{{{*/
-    /**
-     * Calls the function pointed by the object instance.
-     * @tparam _Host_t The type of the host object.
-     * @tparam _Member Pointer to member function.
-     * @param host The address of the host object.
-     * @param param1 First parameter to pass to the function.
-     * @param param2 Second parameter to pass to the function.
-     * @return The same result as the function to be called.
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Member)(_Param1_t, _Param2_t)>
-    static _Return_t invoker(void *host, _Param1_t param1, _Param2_t param2) {
-        _Host_t *p = static_cast<_Host_t *>(host);
-        return (p->*_Member)(param1, param2);
-    }
-    /*}}}*/
-    // static _Return_t const_invoker(void *host, _Param1_t param1, _Param2_t param2) { }/*{{{*/
-    /**
-     * Calls the function pointed by the object instance.
-     * This implementation is used to support const cv-qualified objects.
-     * @tparam _Host_t The type of the host object.
-     * @tparam _Member Pointer to member function.
-     * @param host The address of the host object.
-     * @param param1 First value to pass to the function.
-     * @param param2 Second value to pass to the function.
-     * @return The same result as the function to be called.
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Member)(_Param1_t, _Param2_t) const>
-    static _Return_t const_invoker(void *host, _Param1_t param1, _Param2_t param2) {
-        _Host_t const *p = static_cast<_Host_t *>(host);
-        return (p->*_Member)(param1, param2);
-    }
-    /*}}}*/
-
-    // Data Members
-    void *m_host;               /**< Pointer to the host object instance. */
-    invoker_t m_call;           /**< Pointer to the invoker function.     */
-};
-
-/**
- * Functor implementation.
- * This specialization is selected when bind functions that have a return
- * value and a parameter. The return value can be `void`.
- * @tparam _Return_t Type of return value of the function to be called.
- * @tparam _Param_t Type of the single parameter for the function to be
- * called.
- * @since 1.7
- * @ingroup sstl_functors
- *//* --------------------------------------------------------------------- */
-template <typename _Return_t, typename _Param_t>
-class FunctorT<_Return_t (_Param_t)>
-{
-public:
-    typedef _Return_t (*signature)(_Param_t);   /**< Identifies the signature of this functor. */
-
-    /** @name Constructors & Destructors */ //@{
-    // FunctorT() { }/*{{{*/
-    /**
-     * Default constructor.
-     * Builds an empty functor object.
-     * @since 1.0
-     **/
-    FunctorT() : m_host(NULL), m_call(NULL) { }
-    /*}}}*/
-    // FunctorT(const FunctorT<_Return_t (_Param_t)> &other) { }/*{{{*/
-    /**
-     * Copy constructor.
-     * @param other Another instance to copy its information.
-     * @since 1.0
-     **/
-    FunctorT(const FunctorT<_Return_t (_Param_t)> &other) :
-        m_host(other.m_host), m_call(other.m_call) { }
-    /*}}}*/
-    //@}
-
-    // Static Functions
-    // static FunctorT from(_Host_t *host) { }/*{{{*/
-    /**
-     * Creates an ss::FunctorT instance bound to a pointer to member function.
-     * @tparam _Host_t Type of the host object. The object that declares the
-     * function to be called.
-     * @tparam _Method Pointer to the member function to be called.
-     * @param host Pointer to the instance of the object where the pointer to
-     * member function should be invoked.
-     * @return A new instance of an `ss::FunctorT` object.
-     * @remarks This function must be called on a declaration of a %FunctorT
-     * type. For example, suppose you have an object that declares a function
-     * returning `void` with an `int` parameter. You declare the functor type
-     * and call this function passing the pointer to member function as
-     * template parameter.
-     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
-     * class SomeObject
-     * {
-     *     void fun(int data);
-     * };
-     *
-     * SomeObject object;
-     * ss::FunctorT<void(int)> myFunctor;
-     * myFunctor = ss::FunctorT<void(int)>::from<SomeObject, SomeObject::fun>(&object);
-     ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Param_t)>
-    static FunctorT from(_Host_t *host) {
-        return FunctorT(host, &invoker<_Host_t, _Method>);
-    }
-    /*}}}*/
-    // static FunctorT from(_Host_t const *host) { }/*{{{*/
-    /**
-     * Overload used on a const pointer to member function.
-     * @tparam _Host_t Type of the host object. The object that declares the
-     * function to be called.
-     * @tparam _Method Pointer to the member function to be called.
-     * @param host Pointer to the instance of the object where the pointer to
-     * member function should be invoked.
-     * @return A new instance of an `ss::FunctorT` object.
-     * @remarks This function must be called on a declaration of a %FunctorT
-     * type. For example, suppose you have an object that declares a function
-     * returning `void` with an `int` parameter. You declare the functor type
-     * and call this function passing the pointer to member function as
-     * template parameter.
-     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
-     * class SomeObject
-     * {
-     *     void fun(int data) const;
-     * };
-     *
-     * SomeObject object;
-     * ss::FunctorT<void(int)> myFunctor;
-     * myFunctor = ss::FunctorT<void(int)>::from<SomeObject, SomeObject::fun>(&object);
-     ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Param_t) const>
-    static FunctorT from(_Host_t const *host) {
-        return FunctorT(const_cast<_Host_t*>(host), &const_invoker<_Host_t, _Method>);
-    }
-    /*}}}*/
-
-    /** @name Attributes */ //@{
-    // bool isHost(void *ptr) const { }/*{{{*/
-    /**
-     * Checks whether this object instance points to the specified host.
-     * @param ptr Pointer to the instance of the host object.
-     * @return \b true if the specified address is the same as the host
-     * pointed by this object. \b false otherwise.
-     * @since 1.0
-     **/
-    bool isHost(void *ptr) const {
-        return (m_host == ptr);
-    }
-    /*}}}*/
-    // bool valid() const { }/*{{{*/
-    /**
-     * Checks whether this object is valid.
-     * @returns \b true if this object was bound to a host class and member
-     * function. \b false otherwise.
-     * @note This function doesn't valid the target object and member
-     * function. Only checks whether this functor was bound. The host object
-     * must be valid until this functor is destroyed.
-     * @since 1.0
-     **/
-    bool valid() const {
-        return ((m_host != NULL) && (m_call != NULL));
-    }
-    /*}}}*/
-    //@}
-
-    /** @name Operations */ //@{
-    // void bind(_Host_t *host) { }/*{{{*/
-    /**
-     * Binds a functor with a pointer to member function.
-     * @tparam _Host_t Type of the host object. The object that declares the
-     * function to be called.
-     * @tparam _Method Pointer to the member function to be called.
-     * @param host Pointer to the instance of the object where the pointer to
-     * member function should be invoked.
-     * @remarks This function must be called on a declaration of a %FunctorT
-     * type. For example, suppose you have an object that declares a function
-     * returning `void` with an `int` parameter. You declare the functor type
-     * and call this function passing the pointer to member function as
-     * template parameter.
-     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
-     * class SomeObject
-     * {
-     *     void fun(int data);
-     * };
-     *
-     * SomeObject object;
-     * ss::FunctorT<void(int)> myFunctor;
-     * myFunctor.bind<SomeObject, SomeObject::fun>(&object);
-     ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Param_t)>
-    void bind(_Host_t *host) {
-        m_host = (void *)host;
-        m_call = &invoker<_Host_t, _Method>;
-    }
-    /*}}}*/
-    // void bind(_Host_t const *host) { }/*{{{*/
-    /**
-     * Overload used on a const pointer to member function.
-     * @tparam _Host_t Type of the host object. The object that declares the
-     * function to be called.
-     * @tparam _Method Pointer to the member function to be called.
-     * @param host Pointer to the instance of the object where the pointer to
-     * member function should be invoked.
-     * @remarks This function must be called on a declaration of a %FunctorT
-     * type. For example, suppose you have an object that declares a function
-     * returning `void` with an `int` parameter. You declare the functor type
-     * and call this function passing the pointer to member function as
-     * template parameter.
-     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
-     * class SomeObject
-     * {
-     *     void fun(int data);
-     * };
-     *
-     * SomeObject object;
-     * ss::FunctorT<void(int)> myFunctor;
-     * myFunctor.bind<SomeObject, SomeObject::fun>(&object);
-     ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)(_Param_t) const>
-    void bind(_Host_t const *host) {
-        m_host = (void *)const_cast<_Host_t *>(host);
-        m_call = &const_invoker<_Host_t, _Method>;
-    }
-    /*}}}*/
-    // _Return_t exec(_Param_t param) const { }/*{{{*/
-    /**
-     * Calls the pointer to member function bound to this object.
-     * @param param The parameter to be passed to the function.
-     * @return The value returned by the called function.
-     * @note If no function was bound to this object the behavior is
-     * undefined.
-     * @since 1.0
-     **/
-    _Return_t exec(_Param_t param) const {
-        if (!m_call) return (_Return_t)0;
-        return (*m_call)(m_host, param);
-    }
-    /*}}}*/
-    //@}
-
-    /** @name Overloaded Operators */ //@{
-    // _Return_t operator ()(_Param_t param) const { }/*{{{*/
-    /**
-     * Call the member function pointed to this object.
-     * @param param The parameter to be passed to the function.
-     * @return The value returned by the called function.
-     * @note If no function was bound to this object the behavior is
-     * undefined.
-     * @since 1.0
-     **/
-    _Return_t operator ()(_Param_t param) const {
-        return exec(param);
-    }
-    /*}}}*/
-    // operator bool() const { }/*{{{*/
-    /**
-     * Casting to \b bool operator.
-     * Checks the validity of this functor object.
-     * @return \b true when the object points to a function and its host. \b
-     * false otherwise.
-     * @since 1.0
-     **/
-    operator bool() const {
-        return (m_host && m_call);
-    }
-    /*}}}*/
-    // bool operator !() const { }/*{{{*/
-    /**
-     * Negation operator.
-     * Check if this object is invalid. Invalid objects have not been bound to
-     * a function or object.
-     * @returns \b true when this object is invalid. \b false otherwise.
-     * @since 1.0
-     **/
-    bool operator !() const {
-        return (m_host == NULL || m_call == NULL);
-    }
-    /*}}}*/
-    // bool operator ==(const FunctorT<_Return_t (_Param_t)> &other) const;/*{{{*/
-    /**
-     * Comparison operator.
-     * @param other Another instance to compare with.
-     * @return \b true if both instances points to the same host and function.
-     * \b false otherwise.
-     * @since 1.0
-     **/
-    bool operator ==(const FunctorT<_Return_t (_Param_t)> &other) const {
-        return ((m_host == other.m_host) && (m_call == other.m_call));
-    }
-    /*}}}*/
-    // FunctorT& operator =(const FunctorT<_Return_t (_Param_t)> &other) { }/*{{{*/
-    /**
-     * Copy operator.
-     * @param other Another instance to copy its information.
-     * @return A reference to \b this instance.
-     * @since 1.0
-     **/
-    FunctorT& operator =(const FunctorT<_Return_t (_Param_t)> &other) {
-        m_host = other.m_host;
-        m_call = other.m_call;
-        return *this;
-    }
-    /*}}}*/
-    //@}
-
-private:
-    /** Type of the invoker function. */
-    typedef _Return_t (*invoker_t)(void*, _Param_t);
-
-    /** @name Constructors */ //@{
-    // FunctorT(void *host, invoker_t caller) { }/*{{{*/
-    /**
-     * Parametrized constructor.
-     * Builds an instance defining the host object and the invoker function
-     * used to call the pointer to member of host.
-     * @param host The host object to call.
-     * @param caller Pointer to the static function that does call the member
-     * function of \a host.
-     * @since 1.0
-     **/
-    FunctorT(void *host, invoker_t caller) : m_host(host), m_call(caller) { }
-    /*}}}*/
-    //@}
-
-    // Static Functions
-    // static _Return_t invoker(void *host, _Param_t param) { }/*{{{*/
-    /**
-     * Calls the function pointed by the object instance.
-     * @tparam _Host_t The type of the host object.
-     * @tparam _Member Pointer to member function.
-     * @param host The address of the host object.
-     * @param param Data to be passed as parameter to the pointer to member
-     * function.
-     * @return The same result as the function to be called.
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Member)(_Param_t)>
-    static _Return_t invoker(void *host, _Param_t param) {
-        _Host_t *p = static_cast<_Host_t *>(host);
-        return (p->*_Member)(param);
-    }
-    /*}}}*/
-    // static _Return_t const_invoker(void *host, _Param_t param) { }/*{{{*/
-    /**
-     * Calls the function pointed by the object instance.
-     * This implementation is used to support const cv-qualified objects.
-     * @tparam _Host_t The type of the host object.
-     * @tparam _Member Pointer to member function.
-     * @param host The address of the host object.
-     * @param param Data to be passed as parameter to the pointer to member
-     * function.
-     * @return The same result as the function to be called.
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Member)(_Param_t) const>
-    static _Return_t const_invoker(void *host, _Param_t param) {
-        _Host_t const *p = static_cast<_Host_t *>(host);
-        return (p->*_Member)(param);
-    }
-    /*}}}*/
-
-    // Data Members
-    void *m_host;               /**< Pointer to the host object instance. */
-    invoker_t m_call;           /**< Pointer to the invoker function.     */
-};
-
-/**
- * Another Functor implementation.
- * This specialization is selected when bind functions with no parameters.
- * @tparam _Return_t Type of return value of the function to be called. Can be
- * `void`.
- * @since 1.0
- * @ingroup sstl_functors
- *//* --------------------------------------------------------------------- */
-template <typename _Return_t>
-class FunctorT<_Return_t ()>
-{
-public:
-    typedef _Return_t (*signature)();   /**< This functor function signature. */
-
-    /** @name Constructors & Destructor */ //@{
-    // FunctorT() { }/*{{{*/
-    /**
-     * Default constructor.
-     * Builds an empty functor object.
-     * @since 1.0
-     **/
-    FunctorT() : m_host(NULL), m_call(NULL) { }
-    /*}}}*/
-    // FunctorT(const FunctorT<_Return_t ()> &other) { }/*{{{*/
-    /**
-     * Copy constructor.
-     * @param other Another instance to copy its information.
-     * @since 1.0
-     **/
-    FunctorT(const FunctorT<_Return_t ()> &other) :
-        m_host(other.m_host), m_call(other.m_call) { }
-    /*}}}*/
-    //@}
-
-    // Static Functions
-    // static FunctorT from(_Host_t *host) { }/*{{{*/
-    /**
-     * Creates an ss::FunctorT instance bound to a pointer to member function.
-     * @tparam _Host_t Type of the host object. The object that declares the
-     * function to be called.
-     * @tparam _Method Pointer to the member function to be called.
-     * @param host Pointer to the instance of the object where the pointer to
-     * member function should be invoked.
-     * @return A new instance of an `ss::FunctorT` object.
-     * @remarks This function must be called on a declaration of a %FunctorT
-     * type. For example, suppose you have an object that declares a function
-     * returning `void` with an `int` parameter. You declare the functor type
-     * and call this function passing the pointer to member function as
-     * template parameter.
-     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
-     * class SomeObject
-     * {
-     *     void fun();
-     * };
-     *
-     * SomeObject object;
-     * ss::FunctorT<void()> myFunctor;
-     * myFunctor = ss::FunctorT<void()>::from<SomeObject, SomeObject::fun>(&object);
-     ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)()>
-    static FunctorT from(_Host_t *host) {
-        return FunctorT(host, &invoker<_Host_t, _Method>);
-    }
-    /*}}}*/
-    // static FunctorT from(_Host_t const *host) { }/*{{{*/
-    /**
-     * Overload used on a const pointer to member function.
-     * @tparam _Host_t Type of the host object. The object that declares the
-     * function to be called.
-     * @tparam _Method Pointer to the member function to be called.
-     * @param host Pointer to the instance of the object where the pointer to
-     * member function should be invoked.
-     * @return A new instance of an `ss::FunctorT` object.
-     * @remarks This function must be called on a declaration of a %FunctorT
-     * type. For example, suppose you have an object that declares a function
-     * returning `void` with an `int` parameter. You declare the functor type
-     * and call this function passing the pointer to member function as
-     * template parameter.
-     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
-     * class SomeObject
-     * {
-     *     void fun() const;
-     * };
-     *
-     * SomeObject object;
-     * ss::FunctorT<void()> myFunctor;
-     * myFunctor = ss::FunctorT<void()>::from<SomeObject, SomeObject::fun>(&object);
-     ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)() const>
-    static FunctorT from(_Host_t const *host) {
-        return FunctorT(const_cast<_Host_t*>(host), &const_invoker<_Host_t, _Method>);
-    }
-    /*}}}*/
-
-    /** @name Attributes */ //@{
-    // bool isHost(void *ptr) const { }/*{{{*/
-    /**
-     * Checks whether this object instance points to the specified host.
-     * @param ptr Pointer to the instance of the host object.
-     * @return \b true if the specified address is the same as the host
-     * pointed by this object. \b false otherwise.
-     * @since 1.0
-     **/
-    bool isHost(void *ptr) const {
-        return (m_host == ptr);
-    }
-    /*}}}*/
-    // bool valid() const { }/*{{{*/
-    /**
-     * Checks whether this object is valid.
-     * @returns \b true if this object was bound to a host class and member
-     * function. \b false otherwise.
-     * @note This function doesn't valid the target object and member
-     * function. Only checks whether this functor was bound. The host object
-     * must be valid until this functor is destroyed.
-     * @since 1.0
-     **/
-    bool valid() const {
-        return ((m_host != NULL) && (m_call != NULL));
-    }
-    /*}}}*/
-    //@}
-
-    /** @name Operations */ //@{
-    // void bind(_Host_t *host) { }/*{{{*/
-    /**
-     * Binds a functor with a pointer to member function.
-     * @tparam _Host_t Type of the host object. The object that declares the
-     * function to be called.
-     * @tparam _Method Pointer to the member function to be called.
-     * @param host Pointer to the instance of the object where the pointer to
-     * member function should be invoked.
-     * @remarks This function must be called on a declaration of a %FunctorT
-     * type. For example, suppose you have an object that declares a function
-     * returning `void` with an `int` parameter. You declare the functor type
-     * and call this function passing the pointer to member function as
-     * template parameter.
-     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
-     * class SomeObject
-     * {
-     *     void fun();
-     * };
-     *
-     * SomeObject object;
-     * ss::FunctorT<void()> myFunctor;
-     * myFunctor.bind<SomeObject, SomeObject::fun>(&object);
-     ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)()>
-    void bind(_Host_t *host) {
-        m_host = (void *)host;
-        m_call = &invoker<_Host_t, _Method>;
-    }
-    /*}}}*/
-    // void bind(_Host_t const *host) { }/*{{{*/
-    /**
-     * Overload used on a const pointer to member function.
-     * @tparam _Host_t Type of the host object. The object that declares the
-     * function to be called.
-     * @tparam _Method Pointer to the member function to be called.
-     * @param host Pointer to the instance of the object where the pointer to
-     * member function should be invoked.
-     * @remarks This function must be called on a declaration of a %FunctorT
-     * type. For example, suppose you have an object that declares a function
-     * returning `void` with an `int` parameter. You declare the functor type
-     * and call this function passing the pointer to member function as
-     * template parameter.
-     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
-     * class SomeObject
-     * {
-     *     void fun();
-     * };
-     *
-     * SomeObject object;
-     * ss::FunctorT<void()> myFunctor;
-     * myFunctor.bind<SomeObject, SomeObject::fun>(&object);
-     ~~~~~~~~~~~~~~~~~~~~~
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Method)() const>
-    void bind(_Host_t const *host) {
-        m_host = (void *)const_cast<_Host_t *>(host);
-        m_call = &const_invoker<_Host_t, _Method>;
-    }
-    /*}}}*/
-    // _Return_t exec() const { }/*{{{*/
-    /**
-     * Calls the pointer to member function bound to this object.
-     * @return The value returned by the called function.
-     * @note If no function was bound to this object the behavior is
-     * undefined.
-     * @since 1.0
-     **/
-    _Return_t exec() const {
-        if (!m_call) return (_Return_t)0;
-        return (*m_call)(m_host);
-    }
-    /*}}}*/
-    //@}
-
-    /** @name Overloaded Operators */ //@{
-    // _Return_t operator ()() const { }/*{{{*/
-    /**
-     * Call the member function pointed to this object.
-     * @return The value returned by the called function.
-     * @note If no function was bound to this object the behavior is
-     * undefined.
-     * @since 1.0
-     **/
-    _Return_t operator ()() const {
-        return exec();
-    }
-    /*}}}*/
-    // operator bool() const { }/*{{{*/
-    /**
-     * Casting to \b bool operator.
-     * Checks the validity of this functor object.
-     * @return \b true when the object points to a function and its host. \b
-     * false otherwise.
-     * @since 1.0
-     **/
-    operator bool() const {
-        return (m_host && m_call);
-    }
-    /*}}}*/
-    // bool operator !() const { }/*{{{*/
-    /**
-     * Negation operator.
-     * Check if this object is invalid. Invalid objects have not been bound to
-     * a function or object.
-     * @returns \b true when this object is invalid. \b false otherwise.
-     * @since 1.0
-     **/
-    bool operator !() const {
-        return (m_host == NULL || m_call == NULL);
-    }
-    /*}}}*/
-    // bool operator ==(const FunctorT<_Return_t ()> &other) const;/*{{{*/
-    /**
-     * Comparison operator.
-     * @param other Another instance to compare with.
-     * @return \b true if both instances points to the same host and function.
-     * \b false otherwise.
-     * @since 1.0
-     **/
-    bool operator ==(const FunctorT<_Return_t ()> &other) const {
-        return ((m_host == other.m_host) && (m_call == other.m_call));
-    }
-    /*}}}*/
-    // FunctorT& operator =(const FunctorT<_Return_t ()> &other) { }/*{{{*/
-    /**
-     * Copy operator.
-     * @param other Another instance to copy its information.
-     * @return A reference to \b this instance.
-     * @since 1.0
-     **/
-    FunctorT& operator =(const FunctorT<_Return_t ()> &other) {
-        m_host = other.m_host;
-        m_call = other.m_call;
-        return *this;
-    }
-    /*}}}*/
-    //@}
-
-private:
-    /** Type of the invoker function. */
-    typedef _Return_t (*invoker_t)(void*);
-
-    /** @name Constructors */ //@{
-    // FunctorT(void *host, invoker_t caller) { }/*{{{*/
-    /**
-     * Parametrized constructor.
-     * Builds an instance defining the host object and the invoker function
-     * used to call the pointer to member of host.
-     * @param host The host object to call.
-     * @param caller Pointer to the static function that does call the member
-     * function of \a host.
-     * @since 1.0
-     **/
-    FunctorT(void *host, invoker_t caller) : m_host(host), m_call(caller) { }
-    /*}}}*/
-    //@}
-
-    // Static Functions
-    // static _Return_t invoker(void *host) { }/*{{{*/
-    /**
-     * Calls the function pointed by the object instance.
-     * @tparam _Host_t The type of the host object.
-     * @tparam _Member Pointer to member function.
-     * @param host The address of the host object.
-     * @return The same result as the function to be called.
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Member)()>
-    static _Return_t invoker(void *host) {
-        _Host_t *p = static_cast<_Host_t *>(host);
-        return (p->*_Member)();
-    }
-    /*}}}*/
-    // static _Return_t const_invoker(void *host) { }/*{{{*/
-    /**
-     * Calls the function pointed by the object instance.
-     * This implementation is used to support const cv-qualified objects.
-     * @tparam _Host_t The type of the host object.
-     * @tparam _Member Pointer to member function.
-     * @param host The address of the host object.
-     * @return The same result as the function to be called.
-     * @since 1.0
-     **/
-    template <class _Host_t, _Return_t (_Host_t::*_Member)() const>
-    static _Return_t const_invoker(void *host) {
-        _Host_t const *p = static_cast<_Host_t *>(host);
-        return (p->*_Member)();
-    }
-    /*}}}*/
-
-    // Data Members
-    void *m_host;               /**< Pointer to the host object instance. */
-    invoker_t m_call;           /**< Pointer to the invoker function.     */
-};
+static_assert(std::is_trivially_copyable<FunctorT<void ()> >::value &&
+              std::is_trivially_copyable<FunctorT<int (int)> >::value &&
+              std::is_trivially_copyable<FunctorT<void (int, void*, double)> >::value &&
+              std::is_trivially_copyable<FunctorT<void* (int, int, int, int, int, int)> >::value,
+              "ss::FunctorT must be trivially copyable");
+static_assert((SSTL_FUNCTOR_INLINE_SIZE > sizeof(void *)) ||
+              (sizeof(FunctorT<void (int)>) == 2 * sizeof(void *)),
+              "ss::FunctorT bound to member functions must be two pointers");
+static_assert(noexcept(FunctorT<int (int)>() == FunctorT<int (int)>()) &&
+              noexcept(FunctorT<void ()>().valid()),
+              "ss::FunctorT comparison must not throw");
 
 }   /* namespace ss */
 
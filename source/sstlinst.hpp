@@ -0,0 +1,488 @@
+/**
+ * @file
+ * Declares the instrumentation counters of events and shared pointers.
+ * Instrumentation is enabled by defining the `SSTL_INSTRUMENT` macro. When it
+ * is not defined, the default, `ss::EventT` and `ss::SharedT` have no
+ * instrumentation code at all and the counters declared here are never
+ * updated. When it is defined:
+ * - Each `ss::EventT` with an `ss::EventStats` object set through
+ *   `ss::EventT::instrument()` counts its triggers and samples the latency
+ *   of its delegates;
+ * - Each `ss::SharedT<T>` instantiation counts the live objects of type `T`
+ *   in `sstl::SharedStatsT<T>::stats()`.
+ *
+ * The macro must be defined, or not, equally in all translation units of a
+ * program, before including any header of the library.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLINST_HPP_DEFINED__
+#define __SSTLINST_HPP_DEFINED__
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+
+#ifdef SSTL_INSTRUMENT
+#include <chrono>
+#include <typeinfo>
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+#endif
+
+// #define SSTL_INSTRUMENT_DELEGATES/*{{{*/
+/**
+ * Number of delegates with a separate latency histogram in
+ * `ss::EventStats`. Delegates at this position and after share the last
+ * histogram. Define this macro before including this file to change the
+ * default value.
+ * @since 1.2
+ * @ingroup sstl_events
+ **/
+#ifndef SSTL_INSTRUMENT_DELEGATES
+#define SSTL_INSTRUMENT_DELEGATES       8
+#endif
+/*}}}*/
+// #define SSTL_INSTRUMENT_SAMPLE/*{{{*/
+/**
+ * Sampling interval of delegate latencies.
+ * The delegates of an instrumented event are timed in one trigger every
+ * `SSTL_INSTRUMENT_SAMPLE` triggers. Must be a power of two. Use 1 to time
+ * every trigger. Define this macro before including this file to change the
+ * default value.
+ * @since 1.2
+ * @ingroup sstl_events
+ **/
+#ifndef SSTL_INSTRUMENT_SAMPLE
+#define SSTL_INSTRUMENT_SAMPLE          8
+#endif
+/*}}}*/
+
+namespace ss {
+
+/**
+ * Base class of instrumentation counters.
+ * Every object of a derived class adds it self to a global list when it is
+ * built. The list is iterated with `ss::StatsRegistry`. Objects are never
+ * removed from it so they must have static storage duration.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+class StatsEntry
+{
+public:
+    /** Kind of counters held by an entry. */
+    enum kind_t {
+        Event,                          /**< An `ss::EventStats` object.  */
+        Shared                          /**< An `ss::SharedStats` object. */
+    };
+
+    /** @name Attributes */ //@{
+    // const char* name() const;/*{{{*/
+    /**
+     * Retrieves the name given to the counters.
+     * @since 1.2
+     **/
+    const char* name() const { return m_name; }
+    /*}}}*/
+    // kind_t kind() const;/*{{{*/
+    /**
+     * Retrieves the kind of the counters.
+     * Used to cast the entry to its real type.
+     * @since 1.2
+     **/
+    kind_t kind() const { return m_kind; }
+    /*}}}*/
+    // const StatsEntry* next() const;/*{{{*/
+    /**
+     * Retrieves the next entry in the registry.
+     * @return The entry or \b NULL when this is the last one.
+     * @since 1.2
+     **/
+    const StatsEntry* next() const { return m_next; }
+    /*}}}*/
+    //@}
+
+    // Static Functions
+    // static std::atomic<StatsEntry*>& head();/*{{{*/
+    /**
+     * Head of the global list of entries.
+     * @since 1.2
+     **/
+    static std::atomic<StatsEntry*>& head() {
+        static std::atomic<StatsEntry*> entry(NULL);
+        return entry;
+    }
+    /*}}}*/
+
+protected:
+    // StatsEntry(const char *name, kind_t kind);/*{{{*/
+    /**
+     * Builds the entry and adds it to the registry.
+     * @param name Name of the counters. The string is not copied and must
+     * remain valid while the program runs.
+     * @param kind Kind of the derived class.
+     * @since 1.2
+     **/
+    StatsEntry(const char *name, kind_t kind) : m_name(name), m_kind(kind),
+        m_next(head().load(std::memory_order_relaxed))
+    {
+        while (!head().compare_exchange_weak(m_next, this,
+                    std::memory_order_release, std::memory_order_relaxed))
+            ;
+    }
+    /*}}}*/
+
+private:
+    /** @name Disabled Operations */ //@{
+    StatsEntry(const StatsEntry &) = delete;
+    StatsEntry& operator =(const StatsEntry &) = delete;
+    //@}
+
+    // Data Members
+    const char *m_name;                 /**< Name of the counters.        */
+    kind_t m_kind;                      /**< Type of the derived class.   */
+    StatsEntry *m_next;                 /**< Next entry in the registry.  */
+};
+
+/**
+ * Counters of an event.
+ * Holds the number of times an event was triggered and, for each delegate
+ * position, a latency histogram. Bucket \e i of a histogram counts the
+ * delegate calls that took from 2<sup>i</sup> to 2<sup>i+1</sup> - 1 ticks
+ * of the cycle counter (`sstl::cycles()`). Bucket 0 also counts the calls
+ * that took zero ticks.
+ *
+ * The counters are updated with relaxed atomic operations, so the same
+ * object can be shared by several events and triggered in different
+ * threads.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * static ss::EventStats dataStats("Connection::onData");
+ *
+ * Connection::Connection() {
+ *     onData.instrument(&dataStats);
+ * }
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @note Counters are only updated when `SSTL_INSTRUMENT` is defined.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+class EventStats : public StatsEntry
+{
+public:
+    /** Number of buckets of each histogram. */
+    static const size_t buckets = 64;
+    /** Number of histograms. */
+    static const size_t delegates = SSTL_INSTRUMENT_DELEGATES;
+
+    /** @name Constructors & Destructor */ //@{
+    // explicit EventStats(const char *name);/*{{{*/
+    /**
+     * Builds the counters and adds them to the registry.
+     * @param name Name of the event. The string is not copied.
+     * @since 1.2
+     **/
+    explicit EventStats(const char *name) : StatsEntry(name, Event), m_triggers(0) {
+        for (size_t i = 0; i < delegates; ++i) {
+            for (size_t j = 0; j < buckets; ++j)
+                m_histogram[i][j].store(0, std::memory_order_relaxed);
+        }
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // uint64_t triggers() const;/*{{{*/
+    /**
+     * Retrieves the number of times the event was triggered.
+     * @since 1.2
+     **/
+    uint64_t triggers() const { return m_triggers.load(std::memory_order_relaxed); }
+    /*}}}*/
+    // uint64_t count(size_t delegate, size_t bucket) const;/*{{{*/
+    /**
+     * Retrieves the value of a histogram bucket.
+     * @param delegate Position of the delegate in the event. Positions
+     * greater than `delegates - 1` share the last histogram.
+     * @param bucket Index of the bucket, less than `buckets`.
+     * @return The number of sampled calls of the delegate in that bucket.
+     * @since 1.2
+     **/
+    uint64_t count(size_t delegate, size_t bucket) const {
+        return m_histogram[slot(delegate)][bucket].load(std::memory_order_relaxed);
+    }
+    /*}}}*/
+    // uint64_t samples(size_t delegate) const;/*{{{*/
+    /**
+     * Retrieves the number of sampled calls of a delegate.
+     * @param delegate Position of the delegate in the event.
+     * @return The sum of all buckets of the delegate histogram.
+     * @since 1.2
+     **/
+    uint64_t samples(size_t delegate) const {
+        uint64_t total = 0;
+        for (size_t j = 0; j < buckets; ++j)
+            total += count(delegate, j);
+        return total;
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // bool hit();/*{{{*/
+    /**
+     * Counts a trigger.
+     * @return \b true when the delegates should be timed in this trigger.
+     * @since 1.2
+     **/
+    bool hit() {
+        uint64_t n = m_triggers.fetch_add(1, std::memory_order_relaxed);
+        return ((n & (SSTL_INSTRUMENT_SAMPLE - 1)) == 0);
+    }
+    /*}}}*/
+    // void sample(size_t delegate, uint64_t ticks);/*{{{*/
+    /**
+     * Adds a delegate call to its histogram.
+     * @param delegate Position of the delegate in the event.
+     * @param ticks Duration of the call in cycle counter ticks.
+     * @since 1.2
+     **/
+    void sample(size_t delegate, uint64_t ticks) {
+        size_t bucket = 0;
+        while (ticks >>= 1) ++bucket;
+        m_histogram[slot(delegate)][bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+    /*}}}*/
+    // void reset();/*{{{*/
+    /**
+     * Sets all counters to zero.
+     * @since 1.2
+     **/
+    void reset() {
+        m_triggers.store(0, std::memory_order_relaxed);
+        for (size_t i = 0; i < delegates; ++i) {
+            for (size_t j = 0; j < buckets; ++j)
+                m_histogram[i][j].store(0, std::memory_order_relaxed);
+        }
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** Histogram used by a delegate position. */
+    static size_t slot(size_t delegate) {
+        return ((delegate < delegates) ? delegate : (delegates - 1));
+    }
+
+    // Data Members
+    std::atomic<uint64_t> m_triggers;   /**< Number of triggers.          */
+    std::atomic<uint64_t> m_histogram[delegates][buckets];  /**< Latencies. */
+};
+
+/**
+ * Counters of objects held by shared pointers.
+ * Keeps the number of objects alive, the highest number of objects alive at
+ * the same time and the total number of objects created. There is one of
+ * these for each type used with `ss::SharedT`. See `sstl::SharedStatsT`.
+ * @note Counters are only updated when `SSTL_INSTRUMENT` is defined.
+ * @since 1.2
+ * @ingroup sstl_shared
+ *//* --------------------------------------------------------------------- */
+class SharedStats : public StatsEntry
+{
+public:
+    /** @name Constructors & Destructor */ //@{
+    // explicit SharedStats(const char *name);/*{{{*/
+    /**
+     * Builds the counters and adds them to the registry.
+     * @param name Name of the type of the objects. The string is not copied.
+     * @since 1.2
+     **/
+    explicit SharedStats(const char *name) : StatsEntry(name, Shared),
+        m_live(0), m_peak(0), m_total(0) { }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // intptr_t live() const;/*{{{*/
+    /**
+     * Retrieves the number of objects alive.
+     * @since 1.2
+     **/
+    intptr_t live() const { return m_live.load(std::memory_order_relaxed); }
+    /*}}}*/
+    // intptr_t peak() const;/*{{{*/
+    /**
+     * Retrieves the highest number of objects alive at the same time.
+     * @since 1.2
+     **/
+    intptr_t peak() const { return m_peak.load(std::memory_order_relaxed); }
+    /*}}}*/
+    // uint64_t total() const;/*{{{*/
+    /**
+     * Retrieves the number of objects created.
+     * @since 1.2
+     **/
+    uint64_t total() const { return m_total.load(std::memory_order_relaxed); }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void created();/*{{{*/
+    /**
+     * Counts an object bound to a new control block.
+     * @since 1.2
+     **/
+    void created() {
+        intptr_t live = m_live.fetch_add(1, std::memory_order_relaxed) + 1;
+        intptr_t peak = m_peak.load(std::memory_order_relaxed);
+        while ((live > peak) && !m_peak.compare_exchange_weak(peak, live,
+                    std::memory_order_relaxed))
+            ;
+        m_total.fetch_add(1, std::memory_order_relaxed);
+    }
+    /*}}}*/
+    // void destroyed();/*{{{*/
+    /**
+     * Counts an object released by its last shared pointer.
+     * @since 1.2
+     **/
+    void destroyed() {
+        m_live.fetch_sub(1, std::memory_order_relaxed);
+    }
+    /*}}}*/
+    // void reset();/*{{{*/
+    /**
+     * Sets the peak to the current number of objects alive and the total to
+     * zero.
+     * @since 1.2
+     **/
+    void reset() {
+        m_peak.store(live(), std::memory_order_relaxed);
+        m_total.store(0, std::memory_order_relaxed);
+    }
+    /*}}}*/
+    //@}
+
+private:
+    // Data Members
+    std::atomic<intptr_t> m_live;       /**< Objects alive.               */
+    std::atomic<intptr_t> m_peak;       /**< Maximum of objects alive.    */
+    std::atomic<uint64_t> m_total;      /**< Objects created.             */
+};
+
+/**
+ * Registry of all instrumentation counters.
+ * Lists the `ss::EventStats` and `ss::SharedStats` objects of the program.
+ * New entries can be added at any moment, even while the registry is
+ * iterated, from any thread.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * void dump(const ss::StatsEntry &entry) {
+ *     if (entry.kind() == ss::StatsEntry::Event) {
+ *         const ss::EventStats &e = static_cast<const ss::EventStats &>(entry);
+ *         printf("%s: %llu triggers\n", e.name(), (unsigned long long)e.triggers());
+ *     } else {
+ *         const ss::SharedStats &s = static_cast<const ss::SharedStats &>(entry);
+ *         printf("%s: %ld live, %ld peak\n", s.name(), (long)s.live(), (long)s.peak());
+ *     }
+ * }
+ *
+ * ss::StatsRegistry::visit(&dump);
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+class StatsRegistry
+{
+public:
+    // static const StatsEntry* first();/*{{{*/
+    /**
+     * Retrieves the first entry of the registry.
+     * Use `StatsEntry::next()` to get the following ones.
+     * @return The most recently added entry or \b NULL when there is none.
+     * @since 1.2
+     **/
+    static const StatsEntry* first() {
+        return StatsEntry::head().load(std::memory_order_acquire);
+    }
+    /*}}}*/
+    // static size_t visit(_Functor_t fn);/*{{{*/
+    /**
+     * Calls a function for every entry of the registry.
+     * @param fn Function or functor called with a `const StatsEntry&`.
+     * @return The number of entries visited.
+     * @since 1.2
+     **/
+    template <typename _Functor_t>
+    static size_t visit(_Functor_t fn) {
+        size_t count = 0;
+        for (const StatsEntry *entry = first(); entry; entry = entry->next(), ++count)
+            fn(*entry);
+        return count;
+    }
+    /*}}}*/
+};
+
+}   /* namespace ss */
+
+#ifdef SSTL_INSTRUMENT
+namespace sstl {
+
+// uint64_t cycles();/*{{{*/
+/**
+ * Reads the cycle counter of the processor.
+ * Uses the time stamp counter on x86 processors and the virtual counter on
+ * ARM64. Other processors use `std::chrono::steady_clock`, in nanoseconds.
+ * @since 1.2
+ **/
+inline uint64_t cycles() {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    return __rdtsc();
+#elif defined(__i386__) || defined(__x86_64__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value;
+    __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (value));
+    return value;
+#else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+/*}}}*/
+
+/**
+ * Live object counters of a type held by `ss::SharedT`.
+ * @tparam _Class_t The type of the objects.
+ * @since 1.2
+ **/
+template <class _Class_t>
+struct SharedStatsT
+{
+    // static ss::SharedStats& stats();/*{{{*/
+    /**
+     * Retrieves the counters of the type.
+     * The counters are registered the first time this function is called,
+     * named after `typeid(_Class_t).name()`.
+     * @since 1.2
+     **/
+    static ss::SharedStats& stats() {
+        static ss::SharedStats counters(typeid(_Class_t).name());
+        return counters;
+    }
+    /*}}}*/
+};
+
+}   /* namespace sstl */
+#endif /* SSTL_INSTRUMENT */
+
+#endif /* __SSTLINST_HPP_DEFINED__ */
@@ -0,0 +1,434 @@
+/**
+ * @file
+ * Declares the ss::IntrusiveT and ss::RefCountedT class templates.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLINTR_HPP_DEFINED__
+#define __SSTLINTR_HPP_DEFINED__
+
+#include <utility>
+#include "sstlshrp.hpp"
+
+namespace ss {
+
+/**
+ * Base class for objects with an embedded reference counter.
+ * Objects derived from this class can be shared using `ss::IntrusiveT`.
+ * The counter starts at zero and the object deletes itself when the last
+ * reference is released.
+ * @tparam _Derived_t The class deriving from this template. It is deleted
+ * through a pointer of this type, so no virtual destructor is needed.
+ * @tparam _Policy_t The threading policy of the counter. Defaults to
+ * `ss::MultiThread`.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * class MyClass : public ss::RefCountedT<MyClass> {
+ * public:
+ *     int data;
+ * };
+ *
+ * ss::IntrusiveT<MyClass> pointerA(new MyClass);
+ * ss::IntrusiveT<MyClass> pointerB(pointerA);  // Both share the counter.
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @since 1.2
+ * @ingroup sstl_shared
+ *//* --------------------------------------------------------------------- */
+template <class _Derived_t, class _Policy_t = MultiThread>
+class RefCountedT
+{
+public:
+    /** @name Reference Counting */ //@{
+    // intptr_t retain() const;/*{{{*/
+    /**
+     * Increments the reference counter.
+     * @returns The number of references after the increment.
+     * @since 1.2
+     **/
+    intptr_t retain() const {
+        return _Policy_t::increment(m_refs);
+    }
+    /*}}}*/
+    // intptr_t release() const;/*{{{*/
+    /**
+     * Decrements the reference counter.
+     * @returns The number of references after the decrement. When it
+     * reaches zero the object is deleted.
+     * @since 1.2
+     **/
+    intptr_t release() const {
+        intptr_t result = _Policy_t::decrement(m_refs);
+        if (result <= 0) delete static_cast<const _Derived_t *>(this);
+        return result;
+    }
+    /*}}}*/
+    // intptr_t shares() const;/*{{{*/
+    /**
+     * Retrieves the number of references to this object.
+     * @since 1.2
+     **/
+    intptr_t shares() const {
+        return _Policy_t::value(m_refs);
+    }
+    /*}}}*/
+    //@}
+
+protected:
+    /** @name Constructors & Destructor */ //@{
+    // RefCountedT();/*{{{*/
+    /**
+     * Default constructor.
+     * The object starts with no references.
+     * @since 1.2
+     **/
+    RefCountedT() : m_refs(0) { }
+    /*}}}*/
+    // RefCountedT(const RefCountedT &other);/*{{{*/
+    /**
+     * Copy constructor.
+     * The counter is not copied. The new object starts with no references.
+     * @since 1.2
+     **/
+    RefCountedT(const RefCountedT &) : m_refs(0) { }
+    /*}}}*/
+    // ~RefCountedT();/*{{{*/
+    /**
+     * Destructor.
+     * @since 1.2
+     **/
+    ~RefCountedT() { }
+    /*}}}*/
+    //@}
+
+    // RefCountedT& operator =(const RefCountedT &other);/*{{{*/
+    /**
+     * Copy operator.
+     * The counter is not changed.
+     * @since 1.2
+     **/
+    RefCountedT& operator =(const RefCountedT &) { return *this; }
+    /*}}}*/
+
+private:
+    // Data Members
+    mutable typename _Policy_t::counter_t m_refs;   /**< Reference count. */
+};
+
+/**
+ * Shared pointer for objects with an embedded reference counter.
+ * Has the same interface as `ss::SharedT` but no control block is
+ * allocated: the handle is a single pointer and the counter is kept in the
+ * object. The two templates can be replaced by each other, per type, without
+ * changing the code using them.
+ * @tparam _Class_t The pointer type. Must have the member functions
+ * `retain()` and `release()`, that increment and decrement its reference
+ * counter. `release()` must delete the object when the counter reaches zero.
+ * For `shares()` the type must also have a `shares()` member function.
+ * `ss::RefCountedT` provides all of them.
+ * @remarks Differently from `ss::SharedT`, building a handle always
+ * increments the counter. So a handle can be built from `this` inside a
+ * member function of the object.
+ * @since 1.2
+ * @ingroup sstl_shared
+ *//* --------------------------------------------------------------------- */
+template <class _Class_t>
+class IntrusiveT
+{
+public:
+    // Data Types
+    typedef _Class_t class_t;           /**< Typedef of the class type.     */
+
+    /** @name Constructors & Destructor */ //@{
+    // IntrusiveT();/*{{{*/
+    /**
+     * Default constructor.
+     * Builds an empty object.
+     * @since 1.2
+     **/
+    IntrusiveT() : m_data(NULL) { }
+    /*}}}*/
+    // IntrusiveT(const IntrusiveT &other);/*{{{*/
+    /**
+     * Copy constructor.
+     * @param other Another instance. The pointer it holds is shared with this
+     * instance.
+     * @since 1.2
+     **/
+    IntrusiveT(const IntrusiveT &other) : m_data(other.m_data) {
+        retain();
+    }
+    /*}}}*/
+    // IntrusiveT(IntrusiveT &&other);/*{{{*/
+    /**
+     * Move constructor.
+     * @param other Another instance. Its pointer is transferred to this
+     * instance and \p other becomes empty. The counter doesn't change.
+     * @since 1.2
+     **/
+    IntrusiveT(IntrusiveT &&other) noexcept : m_data(other.m_data) {
+        other.m_data = NULL;
+    }
+    /*}}}*/
+    // explicit IntrusiveT(class_t *ptr);/*{{{*/
+    /**
+     * Parametrized constructor.
+     * @param ptr Pointer to the object to be bound. Its counter is
+     * incremented.
+     * @since 1.2
+     **/
+    explicit IntrusiveT(class_t *ptr) : m_data(ptr) {
+        retain();
+    }
+    /*}}}*/
+    // ~IntrusiveT();/*{{{*/
+    /**
+     * Destructor.
+     * Decrements the counter of the bound object.
+     * @since 1.2
+     **/
+    ~IntrusiveT() {
+        release();
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // class_t* data() const;/*{{{*/
+    /**
+     * Retrieves the bound object, if any.
+     * @since 1.2
+     **/
+    class_t* data() const {
+        return m_data;
+    }
+    /*}}}*/
+    // intptr_t shares() const;/*{{{*/
+    /**
+     * Retrieves the number of references to the bound object.
+     * @return The value of the counter or zero when this handle is empty.
+     * @since 1.2
+     **/
+    intptr_t shares() const {
+        return (m_data ? m_data->shares() : 0);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // IntrusiveT& assign(const IntrusiveT &other);/*{{{*/
+    /**
+     * Assignment operation.
+     * @param other Another instance. The pointer it holds is shared with this
+     * instance.
+     * @return A reference to \b this instance.
+     * @since 1.2
+     **/
+    IntrusiveT& assign(const IntrusiveT &other) {
+        return assign(other.m_data);
+    }
+    /*}}}*/
+    // IntrusiveT& assign(class_t *ptr);/*{{{*/
+    /**
+     * Assignment operation.
+     * @param ptr Pointer to the object to be bound. Its counter is
+     * incremented.
+     * @return A reference to \b this instance.
+     * @since 1.2
+     **/
+    IntrusiveT& assign(class_t *ptr) {
+        if (ptr == m_data) return *this;
+        if (ptr) ptr->retain();
+        release();
+        m_data = ptr;
+        return *this;
+    }
+    /*}}}*/
+    // void swap(IntrusiveT &other);/*{{{*/
+    /**
+     * Exchanges the pointers of two instances.
+     * @param other The other instance. The counters don't change.
+     * @since 1.2
+     **/
+    void swap(IntrusiveT &other) noexcept {
+        class_t *data = m_data;
+        m_data = other.m_data;
+        other.m_data = data;
+    }
+    /*}}}*/
+    // void reset();/*{{{*/
+    /**
+     * Releases the bound object, leaving this instance empty.
+     * @since 1.2
+     **/
+    void reset() noexcept {
+        release();
+    }
+    /*}}}*/
+    // void reset(class_t *ptr);/*{{{*/
+    /**
+     * Releases the bound object and binds another one.
+     * @param ptr Pointer to the object to be bound. Can be \b NULL.
+     * @since 1.2
+     **/
+    void reset(class_t *ptr) {
+        assign(ptr);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // operator bool() const;/*{{{*/
+    /**
+     * Casting to \b bool operator.
+     * @returns \b true if this instance is bound to a pointer. \b false
+     * otherwise.
+     * @since 1.2
+     **/
+    operator bool() const {
+        return (m_data != NULL);
+    }
+    /*}}}*/
+    // bool operator!() const;/*{{{*/
+    /**
+     * Negation operator.
+     * @return \b true when the pointer is not bounded to any instance. \b
+     * false otherwise.
+     * @since 1.2
+     **/
+    bool operator!() const {
+        return (m_data == NULL);
+    }
+    /*}}}*/
+    // class_t* operator->() const;/*{{{*/
+    /**
+     * Point to member operator.
+     * @return The bound object. Can be \b NULL.
+     * @since 1.2
+     **/
+    class_t* operator->() const {
+        return m_data;
+    }
+    /*}}}*/
+    // IntrusiveT& operator=(const IntrusiveT &other);/*{{{*/
+    /**
+     * Assignment operator.
+     * @param other Another instance. The pointer it holds is shared with this
+     * instance.
+     * @return A reference to \b this instance.
+     * @since 1.2
+     **/
+    IntrusiveT& operator=(const IntrusiveT &other) {
+        return assign(other);
+    }
+    /*}}}*/
+    // IntrusiveT& operator=(IntrusiveT &&other);/*{{{*/
+    /**
+     * Move assignment operator.
+     * @param other Another instance. Its pointer is transferred to this
+     * instance and \p other becomes empty. The object previously bound to
+     * this instance is released.
+     * @return A reference to \b this instance.
+     * @since 1.2
+     **/
+    IntrusiveT& operator=(IntrusiveT &&other) noexcept {
+        IntrusiveT(std::move(other)).swap(*this);
+        return *this;
+    }
+    /*}}}*/
+    // IntrusiveT& operator=(class_t *ptr);/*{{{*/
+    /**
+     * Assignment operator overload.
+     * @param ptr Pointer to the object to be bound. Its counter is
+     * incremented.
+     * @return A reference to \b this instance.
+     * @since 1.2
+     **/
+    IntrusiveT& operator=(class_t *ptr) {
+        return assign(ptr);
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** @name Implementation */ //@{
+    // void retain();/*{{{*/
+    /**
+     * Increments the counter of the bound object.
+     * @since 1.2
+     **/
+    void retain() noexcept {
+        if (m_data) m_data->retain();
+    }
+    /*}}}*/
+    // void release();/*{{{*/
+    /**
+     * Decrements the counter of the bound object and leaves this handle
+     * empty.
+     * @since 1.2
+     **/
+    void release() noexcept {
+        class_t *data = m_data;
+        m_data = NULL;
+        if (data) data->release();
+    }
+    /*}}}*/
+    //@}
+
+    // Data Members
+    class_t *m_data;                /**< The bound object. */
+};
+
+// void swap(IntrusiveT<_Class_t> &one, IntrusiveT<_Class_t> &another);/*{{{*/
+/**
+ * Exchanges the pointers of two intrusive pointers.
+ * Found by argument dependent lookup, so generic code calling `swap()`
+ * doesn't change the counters.
+ * @since 1.2
+ * @ingroup sstl_shared
+ **/
+template <class _Class_t>
+void swap(IntrusiveT<_Class_t> &one, IntrusiveT<_Class_t> &another) noexcept {
+    one.swap(another);
+}
+/*}}}*/
+
+}   /* namespace ss */
+
+// bool operator ==(const ss::IntrusiveT<T> &one, const ss::IntrusiveT<U> &another);/*{{{*/
+/**
+ * Overloaded comparison operator.
+ * Compares two instances of ss::IntrusiveT object.
+ * @param one One instance of %ss::IntrusiveT object.
+ * @param another Another instance of %ss::IntrusiveT object.
+ * @return \b true if both instances hold the same object. \b false
+ * otherwise.
+ * @since 1.2
+ * @ingroup sstl_shared_operators
+ **/
+template <class T, class U>
+bool operator ==(const ss::IntrusiveT<T> &one, const ss::IntrusiveT<U> &another) {
+    return (one.data() == another.data());
+}
+/*}}}*/
+// bool operator !=(const ss::IntrusiveT<T> &one, const ss::IntrusiveT<U> &another);/*{{{*/
+/**
+ * Overloaded inequality operator.
+ * Compares two instances of ss::IntrusiveT object.
+ * @param one One instance of %ss::IntrusiveT object.
+ * @param another Another instance of %ss::IntrusiveT object.
+ * @return \b true if both instances hold different objects. \b false
+ * otherwise.
+ * @since 1.2
+ * @ingroup sstl_shared_operators
+ **/
+template <class T, class U>
+bool operator !=(const ss::IntrusiveT<T> &one, const ss::IntrusiveT<U> &another) {
+    return (one.data() != another.data());
+}
+/*}}}*/
+
+#endif /* __SSTLINTR_HPP_DEFINED__ */
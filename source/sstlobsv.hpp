@@ -0,0 +1,361 @@
+/**
+ * @file
+ * Declares the ss::ObservableT class template.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLOBSV_HPP_DEFINED__
+#define __SSTLOBSV_HPP_DEFINED__
+
+#include <cstddef>
+#include <memory>
+#include "sstlprop.hpp"
+#include "sstleven.hpp"
+#include "sstlbatc.hpp"
+
+namespace ss {
+/**
+ * Property that notifies changes of its value.
+ * Works like `ss::PropertyT`: the value is kept in the host object and
+ * accessed through the bound getter and setter functions. `set()` reads the
+ * current value once and calls the setter only when the new value is
+ * different. After the setter runs the `changed` event is triggered with
+ * the old and new values, passed by reference. Setting a property with the
+ * value it already has does nothing, so hosts don't need to compare values
+ * in every setter and observers are not refreshed without need.
+ *
+ * Inside a `ss::PropertyBatch` scope the setter is still called at once, but
+ * the `changed` event is triggered only when the scope ends, once, from the
+ * value before the scope to the final value.
+ * @tparam _Value_t The type of the property value. Must have an `operator
+ * ==`.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * class Model {
+ * public:
+ *     ss::ObservableT<int> count;
+ *
+ *     Model() : m_count(0) {
+ *         ssplink(count, this, Model, getCount, setCount);
+ *     }
+ * private:
+ *     int getCount() const { return m_count; }
+ *     void setCount(int value) { m_count = value; }
+ *     int m_count;
+ * };
+ *
+ * class View {
+ * public:
+ *     void onCount(const int &oldValue, const int &newValue);
+ * };
+ *
+ * model.count.changed.bind<View, &View::onCount>(&view);
+ * model.count = 5;         // onCount(0, 5) is called.
+ * model.count = 5;         // Nothing happens.
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+class ObservableT
+{
+public:
+    /** Type of the event triggered when the value changes. */
+    typedef EventT<void (const _Value_t&, const _Value_t&)> event_t;
+    /** Type of the parameter of `set()`. Value or const reference. */
+    typedef typename sstl::ParamT<_Value_t>::type param_t;
+
+    /** @name Constructor */ //@{
+    // ObservableT();/*{{{*/
+    /**
+     * Default constructor.
+     * @since 1.2
+     **/
+    ObservableT() : m_host(NULL), m_get(NULL), m_set(NULL) { }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void bind(_Host_t *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Getter Pointer to the getter function.
+     * @tparam _Setter Pointer to the setter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Getter)(), void (_Host_t::*_Setter)(_Value_t)>
+    void bind(_Host_t *host) {
+        m_host = (void *)host;
+        m_get  = &getter<_Host_t, _Getter>;
+        m_set  = &setter<_Host_t, _Setter>;
+    }
+    /*}}}*/
+    // void bind(_Host_t const *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * This overloaded version is selected when the getter function is const.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Getter Pointer to the getter function.
+     * @tparam _Setter Pointer to the setter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Getter)() const, void (_Host_t::*_Setter)(_Value_t)>
+    void bind(_Host_t const *host) {
+        m_host = (void *)const_cast<_Host_t*>(host);
+        m_get  = &constget<_Host_t, _Getter>;
+        m_set  = &setter<_Host_t, _Setter>;
+    }
+    /*}}}*/
+    // void bind(_Host_t const *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * This overloaded version is selected when the getter function is const
+     * and the setter returns a reference to the host.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Getter Pointer to the getter function.
+     * @tparam _Setter Pointer to the setter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Getter)() const, _Host_t& (_Host_t::*_Setter)(_Value_t)>
+    void bind(_Host_t const *host) {
+        m_host = (void *)const_cast<_Host_t*>(host);
+        m_get  = &constget<_Host_t, _Getter>;
+        m_set  = &setret<_Host_t, _Setter>;
+    }
+    /*}}}*/
+    // void bind(_Host_t const *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * This overloaded version is selected when the getter function is const
+     * and the setter receives a const reference.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Getter Pointer to the getter function.
+     * @tparam _Setter Pointer to the setter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Getter)() const, void (_Host_t::*_Setter)(const _Value_t&)>
+    void bind(_Host_t const *host) {
+        m_host = (void *)const_cast<_Host_t*>(host);
+        m_get  = &constget<_Host_t, _Getter>;
+        m_set  = &refsetter<_Host_t, _Setter>;
+    }
+    /*}}}*/
+    // _Value_t get() const;/*{{{*/
+    /**
+     * Executes the getter function.
+     * @return The value returned by the getter function.
+     * @since 1.2
+     **/
+    _Value_t get() const { return (*m_get)(m_host); }
+    /*}}}*/
+    // bool set(param_t value);/*{{{*/
+    /**
+     * Changes the value of the property.
+     * The getter is called once to read the current value. When it is equal
+     * to \a value nothing else is done. Otherwise the setter is called and
+     * the `changed` event is triggered, or held when a `ss::PropertyBatch` is
+     * active.
+     * @param value The value to be set.
+     * @return \b true when the value was changed. \b false otherwise.
+     * @since 1.2
+     **/
+    bool set(param_t value) {
+        _Value_t old = get();
+        if (old == value) return false;
+
+        (*m_set)(m_host, value);
+
+        PropertyBatch *batch = PropertyBatch::current();
+        if (!batch)
+            changed(old, value);
+        else if (!batch->find(this))
+            batch->hold(this, &deliver, new _Value_t(std::move(old)));
+        return true;
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // operator _Value_t() const;/*{{{*/
+    /**
+     * Cast to type operator.
+     * This operator calls #get().
+     * @returns The value returned by the `%get()` function.
+     * @since 1.2
+     **/
+    operator _Value_t() const { return get(); }
+    /*}}}*/
+    // _Value_t operator ()() const;/*{{{*/
+    /**
+     * Functor operator.
+     * Calls the #get() function. This operator can be used in places where
+     * the compiler cannot deduce to use the `operator _Value_t()`.
+     * @return The value returned by `%get()`.
+     * @since 1.2
+     **/
+    _Value_t operator ()() const { return get(); }
+    /*}}}*/
+    // ObservableT& operator =(param_t value);/*{{{*/
+    /**
+     * Assignment operator.
+     * This operator calls #set().
+     * @param value The value to be set.
+     * @return A reference to \b this object.
+     * @since 1.2
+     **/
+    ObservableT& operator =(param_t value) {
+        set(value); return *this;
+    }
+    /*}}}*/
+    // ObservableT& operator =(const ObservableT<_Value_t> &other);/*{{{*/
+    /**
+     * Assignment operator overloading.
+     * Copies the value of another property to this one.
+     * @param other Another property to get its value.
+     * @return A reference to \b this object.
+     * @since 1.2
+     **/
+    ObservableT& operator =(const ObservableT<_Value_t> &other) {
+        set(other.get()); return *this;
+    }
+    /*}}}*/
+    // bool operator ==(const _Type_t &value) const;/*{{{*/
+    /**
+     * Equality operator.
+     * @param value The value to compare to.
+     * @return \b true if the value of this property is equal to \a value.
+     * @since 1.2
+     **/
+    template <typename _Type_t>
+    bool operator ==(const _Type_t &value) const {
+        return (get() == value);
+    }
+    /*}}}*/
+    // bool operator !=(const _Type_t &value) const;/*{{{*/
+    /**
+     * Inequality operator.
+     * @param value The value to compare to.
+     * @return \b true if the value of this property is different from \a
+     * value.
+     * @since 1.2
+     **/
+    template <typename _Type_t>
+    bool operator !=(const _Type_t &value) const {
+        return !(get() == value);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Events */ //@{
+    /**
+     * Triggered after the value of the property is changed.
+     * The first argument is the previous value and the second argument is
+     * the new value.
+     * @since 1.2
+     **/
+    event_t changed;
+    //@}
+
+private:
+    /** @name Disabled Operations */ //@{
+    ObservableT(const ObservableT<_Value_t> &) = delete;
+    //@}
+
+    typedef _Value_t (*getfn_t)(void*);
+    typedef void (*setfn_t)(void*, param_t);
+
+    // Static Functions
+    // static void deliver(void *self, void *state, bool fire);/*{{{*/
+    /**
+     * Delivers the notification held by a `ss::PropertyBatch`.
+     * @param self This property.
+     * @param state The value before the batch.
+     * @param fire \b false when the notification must be discarded.
+     * @since 1.2
+     **/
+    static void deliver(void *self, void *state, bool fire) {
+        ObservableT<_Value_t> *p = static_cast<ObservableT<_Value_t> *>(self);
+        std::unique_ptr<_Value_t> old(static_cast<_Value_t *>(state));
+
+        if (fire) {
+            _Value_t now = p->get();
+            if (!(*old == now)) p->changed(*old, now);
+        }
+    }
+    /*}}}*/
+    // static _Value_t getter(void *host) { }/*{{{*/
+    /**
+     * Calls the getter member function in \a host.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)()>
+    static _Value_t getter(void *host) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        return (p->*_Method)();
+    }
+    /*}}}*/
+    // static _Value_t constget(void *host) { }/*{{{*/
+    /**
+     * Calls the const getter member function in \a host.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)() const>
+    static _Value_t constget(void *host) {
+        _Host_t const *p = static_cast<_Host_t*>(host);
+        return (p->*_Method)();
+    }
+    /*}}}*/
+    // static void setter(void *host, param_t value) { }/*{{{*/
+    /**
+     * Calls the setter member function in \a host.
+     * @since 1.2
+     **/
+    template <class _Host_t, void (_Host_t::*_Method)(_Value_t)>
+    static void setter(void *host, param_t value) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        (p->*_Method)(value);
+    }
+    /*}}}*/
+    // static void refsetter(void *host, param_t value) { }/*{{{*/
+    /**
+     * Calls the setter member function, receiving a const reference, in \a
+     * host.
+     * @since 1.2
+     **/
+    template <class _Host_t, void (_Host_t::*_Method)(const _Value_t&)>
+    static void refsetter(void *host, param_t value) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        (p->*_Method)(value);
+    }
+    /*}}}*/
+    // static void setret(void *host, param_t value) { }/*{{{*/
+    /**
+     * Calls the setter member function, that returns a reference to the
+     * host, in \a host.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Host_t& (_Host_t::*_Method)(_Value_t)>
+    static void setret(void *host, param_t value) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        (p->*_Method)(value);
+    }
+    /*}}}*/
+
+    // Data Members
+    void *m_host;           /**< Void pointer to the host object. */
+    getfn_t m_get;          /**< Getter function pointer.         */
+    setfn_t m_set;          /**< Setter function pointer.         */
+};
+
+}   /* namespace ss */
+
+#endif /* __SSTLOBSV_HPP_DEFINED__ */
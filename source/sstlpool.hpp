@@ -0,0 +1,719 @@
+/**
+ * @file
+ * Declares the ss::ThreadPool class and the ss::ParallelEventT template.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLPOOL_HPP_DEFINED__
+#define __SSTLPOOL_HPP_DEFINED__
+
+#if (__cplusplus < 201103L) && (!defined(_MSC_VER) || (_MSC_VER < 1800))
+#error "sstlpool.hpp requires a C++11 compiler"
+#endif
+
+#include <cstddef>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "sstleven.hpp"
+
+namespace ss {
+
+/**
+ * Work stealing thread pool.
+ * Keeps a fixed number of worker threads. Each worker has its own queue of
+ * tasks. A worker takes tasks from the back of its own queue and, when it
+ * is empty, steals tasks from the front of the queues of the other workers.
+ * Tasks submitted from outside the pool are distributed among the workers
+ * in a round robin fashion.
+ *
+ * Tasks are plain function pointers with a context pointer and an index,
+ * like `ss::FunctorT`, so submitting a task never allocates memory for the
+ * task it self.
+ * @note Requires C++11.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+class ThreadPool
+{
+public:
+    /** Type of a task function. */
+    typedef void (*task_fn)(void *context, size_t index);
+
+    /** @name Constructors & Destructor */ //@{
+    // explicit ThreadPool(size_t threads = 0);/*{{{*/
+    /**
+     * Starts the pool.
+     * @param threads Number of worker threads. When zero the number of
+     * hardware threads is used.
+     * @since 1.2
+     **/
+    explicit ThreadPool(size_t threads = 0) : m_pending(0), m_next(0), m_stop(false) {
+        if (threads == 0) threads = std::thread::hardware_concurrency();
+        if (threads == 0) threads = 1;
+
+        m_queues.reserve(threads);
+        for (size_t i = 0; i < threads; ++i)
+            m_queues.push_back(new queue_t);
+        for (size_t i = 0; i < threads; ++i)
+            m_threads.push_back(std::thread(&ThreadPool::work, this, i));
+    }
+    /*}}}*/
+    // ~ThreadPool();/*{{{*/
+    /**
+     * Stops the pool.
+     * Waits for all submitted tasks to be executed and the workers to exit.
+     * @since 1.2
+     **/
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_stop = true;
+        }
+        m_wakeup.notify_all();
+
+        for (size_t i = 0; i < m_threads.size(); ++i)
+            m_threads[i].join();
+        for (size_t i = 0; i < m_queues.size(); ++i)
+            delete m_queues[i];
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // size_t size() const;/*{{{*/
+    /**
+     * Retrieves the number of worker threads.
+     * @since 1.2
+     **/
+    size_t size() const { return m_threads.size(); }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void submit(task_fn fn, void *context, size_t index);/*{{{*/
+    /**
+     * Submits a task to be executed by the pool.
+     * @param fn Function to call.
+     * @param context Pointer passed to \a fn.
+     * @param index Value passed to \a fn.
+     * @remarks When called from a worker thread the task goes to the queue
+     * of that worker. Otherwise it goes to the next worker queue.
+     * @since 1.2
+     **/
+    void submit(task_fn fn, void *context, size_t index) {
+        task_t task = { fn, context, index };
+        size_t target = (current() == this) ? worker() : (m_next++ % m_queues.size());
+
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            ++m_pending;        /* Before the push, so it never underflows. */
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_queues[target]->lock);
+            m_queues[target]->tasks.push_back(task);
+        }
+        m_wakeup.notify_one();
+    }
+    /*}}}*/
+    // bool help();/*{{{*/
+    /**
+     * Executes one pending task in the calling thread.
+     * Used by threads waiting on tasks of this pool, so they do useful work
+     * instead of blocking. This also avoids dead locks when the waiting
+     * thread is a worker of this pool.
+     * @return \b true if a task was executed. \b false when there were no
+     * pending tasks.
+     * @since 1.2
+     **/
+    bool help() {
+        task_t task;
+        size_t start = (current() == this) ? worker() : 0;
+        if (!take(start, task)) return false;
+        task.fn(task.context, task.index);
+        return true;
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Static Functions */ //@{
+    // static ThreadPool& instance();/*{{{*/
+    /**
+     * Retrieves the pool shared by the library.
+     * The pool is created on the first call with one worker per hardware
+     * thread.
+     * @since 1.2
+     **/
+    static ThreadPool& instance() {
+        static ThreadPool pool;
+        return pool;
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** A task in a queue. */
+    struct task_t {
+        task_fn fn;                     /**< Function to call.      */
+        void *context;                  /**< Function context.      */
+        size_t index;                   /**< Function parameter.    */
+    };
+
+    /** Queue of a worker. */
+    struct queue_t {
+        std::mutex lock;                /**< Guards the queue.      */
+        std::deque<task_t> tasks;       /**< Pending tasks.         */
+    };
+
+    /** @name Implementation */ //@{
+    // static ThreadPool*& current();/*{{{*/
+    /**
+     * Pool of the calling thread, if it is a worker.
+     * @since 1.2
+     **/
+    static ThreadPool*& current() {
+        static thread_local ThreadPool *pool = NULL;
+        return pool;
+    }
+    /*}}}*/
+    // static size_t& worker();/*{{{*/
+    /**
+     * Index of the calling worker thread in its pool.
+     * @since 1.2
+     **/
+    static size_t& worker() {
+        static thread_local size_t index = 0;
+        return index;
+    }
+    /*}}}*/
+    // bool take(size_t start, task_t &task);/*{{{*/
+    /**
+     * Takes a task from the queues.
+     * The back of the queue at \a start is tried first. Then the front of
+     * the others.
+     * @since 1.2
+     **/
+    bool take(size_t start, task_t &task) {
+        size_t count = m_queues.size();
+        for (size_t i = 0; i < count; ++i) {
+            queue_t *q = m_queues[(start + i) % count];
+            std::lock_guard<std::mutex> lock(q->lock);
+            if (q->tasks.empty()) continue;
+
+            if (i == 0) {
+                task = q->tasks.back();
+                q->tasks.pop_back();
+            } else {
+                task = q->tasks.front();
+                q->tasks.pop_front();
+            }
+            std::lock_guard<std::mutex> global(m_lock);
+            --m_pending;
+            return true;
+        }
+        return false;
+    }
+    /*}}}*/
+    // void work(size_t index);/*{{{*/
+    /**
+     * Worker thread loop.
+     * @since 1.2
+     **/
+    void work(size_t index) {
+        current() = this;
+        worker()  = index;
+
+        task_t task;
+        for (;;) {
+            if (take(index, task)) {
+                task.fn(task.context, task.index);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_lock);
+            if (m_pending > 0) continue;
+            if (m_stop) return;
+            m_wakeup.wait(lock);
+        }
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Disabled Operations */ //@{
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool& operator =(const ThreadPool &) = delete;
+    //@}
+
+    // Data Members
+    std::vector<queue_t *> m_queues;        /**< One queue per worker.      */
+    std::vector<std::thread> m_threads;     /**< Worker threads.            */
+    std::mutex m_lock;                      /**< Guards the fields below.   */
+    std::condition_variable m_wakeup;       /**< Signals new tasks.         */
+    size_t m_pending;                       /**< Tasks in all queues.       */
+    std::atomic<size_t> m_next;             /**< Round robin counter.       */
+    bool m_stop;                            /**< Pool is shutting down.     */
+};
+
+/**
+ * Completion handle of a group of tasks.
+ * Counts the tasks of a group that are not finished yet. Threads waiting
+ * on the group execute pending tasks of the pool while waiting.
+ * @note Requires C++11.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+class TaskGroup
+{
+public:
+    /** @name Constructors & Destructor */ //@{
+    // TaskGroup();/*{{{*/
+    /**
+     * Builds an empty group.
+     * @since 1.2
+     **/
+    TaskGroup() : m_pool(NULL), m_pending(0) { }
+    /*}}}*/
+    // ~TaskGroup();/*{{{*/
+    /**
+     * Destructor.
+     * Waits for all tasks of the group.
+     * @since 1.2
+     **/
+    ~TaskGroup() { wait(); }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // bool done() const;/*{{{*/
+    /**
+     * Checks whether all tasks of the group have finished.
+     * @since 1.2
+     **/
+    bool done() const {
+        return (m_pending.load(std::memory_order_acquire) == 0);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void start(ThreadPool *pool, size_t count);/*{{{*/
+    /**
+     * Adds tasks to the group.
+     * Must be called before the tasks are submitted.
+     * @param pool The pool executing the tasks.
+     * @param count Number of tasks to add.
+     * @since 1.2
+     **/
+    void start(ThreadPool *pool, size_t count) {
+        m_pool = pool;
+        m_pending.fetch_add(count, std::memory_order_relaxed);
+    }
+    /*}}}*/
+    // void finish();/*{{{*/
+    /**
+     * Marks one task of the group as finished.
+     * @since 1.2
+     **/
+    void finish() {
+        m_pending.fetch_sub(1, std::memory_order_release);
+    }
+    /*}}}*/
+    // void wait();/*{{{*/
+    /**
+     * Waits until all tasks of the group finish.
+     * The calling thread executes pending tasks of the pool while waiting.
+     * @since 1.2
+     **/
+    void wait() {
+        while (!done()) {
+            if (!m_pool || !m_pool->help()) std::this_thread::yield();
+        }
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** @name Disabled Operations */ //@{
+    TaskGroup(const TaskGroup &) = delete;
+    TaskGroup& operator =(const TaskGroup &) = delete;
+    //@}
+
+    // Data Members
+    ThreadPool *m_pool;                     /**< Pool running the tasks.    */
+    std::atomic<size_t> m_pending;          /**< Tasks not finished yet.    */
+};
+
+/**
+ * How a delegate of an `ss::ParallelEventT` is executed.
+ * @since 1.2
+ * @ingroup sstl_events
+ **/
+enum ExecutionPolicy {
+    SerialExecution,            /**< Always in the triggering thread.   */
+    ParallelExecution           /**< In the pool, by `trigger_parallel()`. */
+};
+
+/**
+ * Event that can run its delegates in parallel.
+ * Has the same interface of `ss::EventT`. In addition, `trigger_parallel()`
+ * splits the list of delegates in chunks and executes them in a
+ * `ss::ThreadPool`. When binding a delegate the subscriber can choose
+ * whether it can run in the pool or must run in the triggering thread.
+ * @tparam _Signature_t The signature of the functions to handle this event.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * ss::ParallelEventT<void(const Frame&)> onFrame;
+ * onFrame.bind<Filter, &Filter::apply>(&filter);     // Parallel.
+ * onFrame.bind<View, &View::update>(&view, ss::SerialExecution);
+ *
+ * onFrame.trigger_parallel(frame);   // Returns when all have finished.
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @warning The list of delegates must not change while a parallel trigger
+ * is running. Delegates running in parallel must be independent of each
+ * other. This event is not thread safe. Only the delegates run in other
+ * threads.
+ * @note Requires C++11.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Signature_t> class ParallelEventT;
+
+/**
+ * Parallel event for functions with any number of arguments.
+ * @tparam _Return_t The return type of the function. Should be void.
+ * @tparam _Args_t Types of the function parameters.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Return_t, typename... _Args_t>
+class ParallelEventT<_Return_t (_Args_t...)>
+{
+    template <class _Tuple_t> struct job_t;
+
+public:
+    // typedef ss::FunctorT<_Return_t (_Args_t...)> Delegate;/*{{{*/
+    /**
+     * Type of the delegate to be bound to this event.
+     **/
+    typedef ss::FunctorT<_Return_t (_Args_t...)> Delegate;
+    /*}}}*/
+
+    // class Completion;/*{{{*/
+    /**
+     * Completion handle of `trigger_async()`.
+     * Holds a copy of the arguments of the trigger until all delegates run.
+     * `wait()` throws the first exception thrown by a parallel delegate.
+     * The destructor waits for the completion and discards the exception.
+     * @since 1.2
+     **/
+    class Completion : public TaskGroup {
+        friend class ParallelEventT;
+        typedef std::tuple<typename std::decay<_Args_t>::type...> args_t;
+        job_t<args_t> *m_job;
+    public:
+        Completion() : m_job(NULL) { }
+        ~Completion() { TaskGroup::wait(); delete m_job; }
+
+        void wait() {
+            TaskGroup::wait();
+            if (m_job) m_job->rethrow();
+        }
+    };
+    /*}}}*/
+
+    /** @name Constructors & Destructor */ //@{
+    // explicit ParallelEventT(ThreadPool *pool = NULL);/*{{{*/
+    /**
+     * Default constructor.
+     * @param pool The pool used by `trigger_parallel()`. When \b NULL the
+     * pool shared by the library, `ss::ThreadPool::instance()`, is used.
+     * @since 1.2
+     **/
+    explicit ParallelEventT(ThreadPool *pool = NULL) : m_pool(pool) { }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // size_t count() const;/*{{{*/
+    /**
+     * Retrieves the number of bound functors.
+     * @since 1.2
+     **/
+    size_t count() const { return m_delegates.count(); }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void bind(_Target_t *target, ExecutionPolicy policy);/*{{{*/
+    /**
+     * Add a new functor object in the list of delegates.
+     * @tparam _Target_t Type of the target class object.
+     * @tparam _Method Pointer to the member function to be invoked.
+     * @param target Pointer to the instance of \a _Target_t object on the \a
+     * _Method will be called.
+     * @param policy Whether the delegate can run in the pool on a parallel
+     * trigger. The default is to allow it.
+     * @since 1.2
+     **/
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...)>
+    void bind(_Target_t *target, ExecutionPolicy policy = ParallelExecution) {
+        Delegate dl;
+        dl.template bind<_Target_t, _Method>(target);
+        add(dl, policy);
+    }
+    /*}}}*/
+    // void bind(_Target_t const *target, ExecutionPolicy policy);/*{{{*/
+    /**
+     * Add a new functor object in the list of delegates.
+     * This is an overloaded member function, for const member functions.
+     * @since 1.2
+     **/
+    template <class _Target_t, _Return_t (_Target_t::*_Method)(_Args_t...) const>
+    void bind(_Target_t const *target, ExecutionPolicy policy = ParallelExecution) {
+        Delegate dl;
+        dl.template bind<_Target_t, _Method>(target);
+        add(dl, policy);
+    }
+    /*}}}*/
+    // void unbound(_Target_t *target);/*{{{*/
+    /**
+     * Removes all delegates bound to an object.
+     * @param target Pointer to the object instance that was used to create
+     * the delegate objects.
+     * @since 1.2
+     **/
+    template <class _Target_t>
+    void unbound(_Target_t *target) {
+        m_delegates.removeHost((void *)target);
+    }
+    /*}}}*/
+    // void trigger(_Params_t&&... args);/*{{{*/
+    /**
+     * Trigger all functions bound to this event in the calling thread.
+     * @param args Arguments to pass to the functions. They are passed by
+     * reference down to the bound functions.
+     * @since 1.2
+     **/
+    template <typename... _Params_t>
+    void trigger(_Params_t&&... args) {
+        typename sstl::DelegateListT<entry_t>::Scope scope(m_delegates);
+        for (size_t i = 0; i < m_delegates.size(); ++i) {
+            /* Called from a copy, as in ss::EventT::trigger(). */
+            Delegate delegate = m_delegates[i].delegate;
+            delegate.exec(args...);
+        }
+    }
+    /*}}}*/
+    // void trigger_parallel(_Params_t&&... args);/*{{{*/
+    /**
+     * Trigger the functions bound to this event using the thread pool.
+     * Delegates bound with `ss::ParallelExecution` are split in chunks
+     * executed by the pool. Delegates bound with `ss::SerialExecution` run
+     * in the calling thread, in the order they were added, while the pool
+     * works. The function returns when all delegates have finished, also
+     * when a delegate throws.
+     * @param args Arguments to pass to the functions. They are passed by
+     * reference down to the bound functions.
+     * @throws The exception of a serial delegate. Otherwise, the first
+     * exception thrown by a parallel delegate. The other delegates still
+     * run.
+     * @since 1.2
+     **/
+    template <typename... _Params_t>
+    void trigger_parallel(_Params_t&&... args) {
+        typedef std::tuple<typename std::remove_reference<_Params_t>::type&...> refs_t;
+
+        /* The group is destroyed first: it waits for the chunks using job. */
+        job_t<refs_t> job(this, refs_t(args...));
+        TaskGroup group;
+        dispatch(group, job);
+        group.wait();
+        job.rethrow();
+    }
+    /*}}}*/
+    // void trigger_async(Completion &done, _Params_t&&... args);/*{{{*/
+    /**
+     * Trigger the functions bound to this event without waiting for the
+     * parallel delegates.
+     * Works as `trigger_parallel()` but returns as soon as the serial
+     * delegates have run. The arguments are copied into \a done.
+     * @param done Completion handle. Call `done.wait()` to join the parallel
+     * delegates and get their exceptions. Must not be in use by another
+     * trigger. An exception of a previous trigger not taken by `wait()` is
+     * discarded.
+     * @param args Arguments to pass to the functions.
+     * @since 1.2
+     **/
+    template <typename... _Params_t>
+    void trigger_async(Completion &done, _Params_t&&... args) {
+        done.TaskGroup::wait();
+        delete done.m_job;
+        done.m_job = new job_t<typename Completion::args_t>(this,
+            typename Completion::args_t(std::forward<_Params_t>(args)...));
+        dispatch(done, *done.m_job);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Helpers */ //@{
+    // void add(const Delegate &callback, ExecutionPolicy policy);/*{{{*/
+    /**
+     * Adds a delegate object into the list of this event.
+     * @param callback The delegate object to add. The same delegate will not
+     * be added twice.
+     * @param policy How the delegate is executed by `trigger_parallel()`.
+     * @since 1.2
+     **/
+    void add(const Delegate &callback, ExecutionPolicy policy = ParallelExecution) {
+        m_delegates.add(entry_t(callback, policy));
+    }
+    /*}}}*/
+    // void remove(const Delegate &callback);/*{{{*/
+    /**
+     * Removes a callback function from the list of this event.
+     * @since 1.2
+     **/
+    void remove(const Delegate &callback) {
+        m_delegates.remove(entry_t(callback, SerialExecution));
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // ParallelEventT& operator <<(const Delegate &delegate);/*{{{*/
+    /**
+     * Adds a delegate object into the list of this event.
+     * @since 1.2
+     **/
+    ParallelEventT& operator <<(const Delegate &delegate) {
+        add(delegate);
+        return *this;
+    }
+    /*}}}*/
+    // void operator ()(_Params_t&&... args);/*{{{*/
+    /**
+     * Invokes all delegates in the calling thread.
+     * @since 1.2
+     **/
+    template <typename... _Params_t>
+    void operator ()(_Params_t&&... args) {
+        this->trigger(std::forward<_Params_t>(args)...);
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** A delegate and its execution policy. */
+    struct entry_t {
+        Delegate delegate;
+        bool parallel;
+
+        entry_t() : parallel(false) { }
+        entry_t(const Delegate &d, ExecutionPolicy p) :
+            delegate(d), parallel(p == ParallelExecution) { }
+
+        void* host() const { return delegate.host(); }
+        bool isHost(void *ptr) const { return delegate.isHost(ptr); }
+        size_t hash() const { return delegate.hash(); }
+        bool operator ==(const entry_t &other) const {
+            return (delegate == other.delegate);
+        }
+    };
+
+    /** State of a parallel trigger. */
+    template <class _Tuple_t>
+    struct job_t {
+        ParallelEventT *event;
+        TaskGroup *group;
+        _Tuple_t args;
+        size_t grain;
+        std::atomic<bool> failed;
+        std::exception_ptr error;   /* First exception of a chunk. */
+
+        job_t(ParallelEventT *e, const _Tuple_t &a) : event(e), group(NULL), args(a),
+            grain(1), failed(false) { }
+
+        void rethrow() {
+            if (!error) return;
+            std::exception_ptr e = error;
+            error = nullptr;
+            failed.store(false, std::memory_order_relaxed);
+            std::rethrow_exception(e);
+        }
+
+        template <size_t... _Index>
+        void call(const Delegate &d, sstl::IndexesT<_Index...>) {
+            d.exec(std::get<_Index>(args)...);
+        }
+
+        void run(size_t begin, bool parallel) {
+            size_t end = (parallel ? begin + grain : event->m_delegates.size());
+            if (end > event->m_delegates.size()) end = event->m_delegates.size();
+
+            for (size_t i = begin; i < end; ++i) {
+                entry_t e = event->m_delegates[i];
+                if (e.parallel != parallel) continue;
+                if (!parallel) {
+                    call(e.delegate, typename sstl::MakeIndexesT<sizeof...(_Args_t)>::type());
+                    continue;
+                }
+
+                /* Exceptions cannot leave a task of the pool. */
+                try {
+                    call(e.delegate, typename sstl::MakeIndexesT<sizeof...(_Args_t)>::type());
+                } catch (...) {
+                    if (!failed.exchange(true, std::memory_order_relaxed))
+                        error = std::current_exception();
+                }
+            }
+        }
+
+        static void chunk(void *context, size_t index) {
+            job_t *job = static_cast<job_t *>(context);
+            job->run(index * job->grain, true);
+            job->group->finish();
+        }
+    };
+
+    // void dispatch(TaskGroup &group, job_t<_Tuple_t> &job);/*{{{*/
+    /**
+     * Submits the chunks of parallel delegates and runs the serial ones.
+     * @since 1.2
+     **/
+    template <class _Tuple_t>
+    void dispatch(TaskGroup &group, job_t<_Tuple_t> &job) {
+        ThreadPool *pool = (m_pool ? m_pool : &ThreadPool::instance());
+        size_t count = m_delegates.size();
+        size_t chunks = pool->size() * 4;
+
+        job.group = &group;
+        job.grain = (count + chunks - 1) / chunks;
+        if (job.grain == 0) job.grain = 1;
+        chunks = (count + job.grain - 1) / job.grain;
+
+        group.start(pool, chunks);
+        for (size_t i = 0; i < chunks; ++i)
+            pool->submit(&job_t<_Tuple_t>::chunk, &job, i);
+
+        job.run(0, false);
+    }
+    /*}}}*/
+
+    // Data Members
+    ThreadPool *m_pool;                         /**< Pool for parallel runs.  */
+    sstl::DelegateListT<entry_t> m_delegates;   /**< Bound delegates.         */
+};
+
+}   /* namespace ss */
+
+#endif /* __SSTLPOOL_HPP_DEFINED__ */
@@ -0,0 +1,20 @@
+/**
+ * @file
+ * Compiled instances of the property classes.
+ * Built by `make lib`. Programs linking the library define the
+ * `SSTL_EXTERN_TEMPLATES` macro so these instances are not compiled again in
+ * each translation unit.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#include <string>
+#include "sstlprop.hpp"
+
+SSTL_PROPERTY_INSTANCES(, int);
+SSTL_PROPERTY_INSTANCES(, bool);
+SSTL_PROPERTY_INSTANCES(, double);
+SSTL_PROPERTY_INSTANCES(, std::string);
@@ -0,0 +1,493 @@
+/**
+ * @file
+ * Declares the ro::PropertyT class template.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLPRRO_HPP_DEFINED__
+#define __SSTLPRRO_HPP_DEFINED__
+
+#include "sstlprtr.hpp"
+
+namespace ro {
+/**
+ * Read only property class template.
+ * This object is able to mimic property like member variables in a class
+ * definition. The class doesn't hold the data of the property. Instead you
+ * must write a getter function and \e bind it to the property
+ * object instance. This version can be used both for scalar and object like
+ * data members but, different of `ss::PropertyT` it doens't overload any
+ * common operator. To force the object to return the property value and use
+ * it where automatic conversions are not supported use the `operator ()`
+ * operator.
+ * @tparam _Value_t The type of the property value.
+ * @since 1.0
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+class PropertyT
+{
+public:
+    /** @name Constructor */ //@{
+    // PropertyT();/*{{{*/
+    /**
+     * Default constructor.
+     * @since 1.0
+     **/
+    PropertyT() : m_host(NULL), m_get(NULL) { }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void bind(_Host_t *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Method Pointer to the getter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)()>
+    void bind(_Host_t *host) {
+        m_host = (void *)host;
+        m_get  = &getter<_Host_t, _Method>;
+    }
+    /*}}}*/
+    // void bind(_Host_t *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * This overloaded version is selected when the getter function is const.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Method Pointer to the getter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)() const>
+    void bind(_Host_t const *host) {
+        m_host = (void *)const_cast<_Host_t*>(host);
+        m_get  = &constget<_Host_t, _Method>;
+    }
+    /*}}}*/
+    // _Value_t get() const;/*{{{*/
+    /**
+     * Executes the getter function.
+     * @return The value returned by the getter function.
+     * @since 1.0
+     **/
+    _Value_t get() const { return (*m_get)(m_host); }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // operator _Value_t() const;/*{{{*/
+    /**
+     * Cast to type operator.
+     * This operator calls #get().
+     * @returns The value returned by the `%get()` function.
+     * @since 1.0
+     **/
+    operator _Value_t() const { return get(); }
+    /*}}}*/
+    // _Value_t operator ()() const;/*{{{*/
+    /**
+     * Functor operator.
+     * Calls the #get() function. This operator can be used in places where
+     * the compiler cannot deduce to use the `operator _Value_t()`.
+     * @return The value returned by `%get()`.
+     * @since 1.0
+     **/
+    _Value_t operator ()() const { return get(); }
+    /*}}}*/
+    //@}
+
+    /** @name Comparison Operators */ //@{
+    // bool operator ! () const;/*{{{*/
+    /**
+     * Negation operator.
+     * @returns \b true when the value of this property can be convertibal to
+     * a \b falsy result. \b false otherwise.
+     * @since 1.0
+     **/
+    bool operator ! () const {
+        return !bool(get());
+    }
+    /*}}}*/
+    // bool operator ==(_Type_t value) const;/*{{{*/
+    /**
+     * Equality operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value The value to compare to. Must be implicitly convertible to
+     * the type of this property object.
+     * @return \b true if the passed \a value and the value pointed by this
+     * property are equals. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator ==(_Type_t value) const {
+        return (get() == value);
+    }
+    /*}}}*/
+    // bool operator !=(_Type_t value) const;/*{{{*/
+    /**
+     * Inequality operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @param value The value to compare to.
+     * @return \b true if the passed \a value and the value pointed by this
+     * property are different. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator !=(_Type_t value) const {
+        return (get() != value);
+    }
+    /*}}}*/
+    // bool operator < (_Type_t value) const;/*{{{*/
+    /**
+     * Less than operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @param value The value to compare to.
+     * @return \b true when the value returned by this property object is
+     * \it{less than} the passed \a value. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator < (_Type_t value) const {
+        return (get() < value);
+    }
+    /*}}}*/
+    // bool operator <=(_Type_t value) const;/*{{{*/
+    /**
+     * Less than or equal operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @param value The value to compare to.
+     * @return \b true when the value returned by this property object is
+     * \it{less than or equal} the passed \a value. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator <=(_Type_t value) const {
+        return (get() <= value);
+    }
+    /*}}}*/
+    // bool operator > (_Type_t value) const;/*{{{*/
+    /**
+     * Greater than operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @param value The value to compare to.
+     * @return \b true when the value returned by this property object is
+     * \it{greater than} the passed \a value. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator > (_Type_t value) const {
+        return (get() > value);
+    }
+    /*}}}*/
+    // bool operator >=(_Type_t value) const;/*{{{*/
+    /**
+     * Greater than or equal operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @param value The value to compare to.
+     * @return \b true when the value returned by this property object is
+     * \it{greater than or equal} the passed \a value. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator >=(_Type_t value) const {
+        return (get() >= value);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Mathematical Operators */ //@{
+    // _Value_t operator + (_Type_t value) const;/*{{{*/
+    /**
+     * Addition operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator doesn't change the value of the property pointed
+     * by this object neither the value of the \a value parameter. Just the
+     * operation is done and the resulting value will be returned.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator + (_Type_t value) const {
+        return (get() + value);
+    }
+    /*}}}*/
+    // _Value_t operator - (_Type_t value) const;/*{{{*/
+    /**
+     * Subtraction operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator doesn't change the value of the property pointed
+     * by this object neither the value of the \a value parameter. Just the
+     * operation is done and the resulting value will be returned.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator - (_Type_t value) const {
+        return (get() - value);
+    }
+    /*}}}*/
+    // _Value_t operator * (_Type_t value) const;/*{{{*/
+    /**
+     * Multiplication operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator doesn't change the value of the property pointed
+     * by this object neither the value of the \a value parameter. Just the
+     * operation is done and the resulting value will be returned.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator * (_Type_t value) const {
+        return (get() * value);
+    }
+    /*}}}*/
+    // _Value_t operator / (_Type_t value) const;/*{{{*/
+    /**
+     * Division operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator doesn't change the value of the property pointed
+     * by this object neither the value of the \a value parameter. Just the
+     * operation is done and the resulting value will be returned.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator / (_Type_t value) const {
+        return (get() / value);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Bitwise Operators */ //@{
+    // _Value_t operator | (_Type_t value) const;/*{{{*/
+    /**
+     * Bitwise OR opeator.
+     * "OR" the value of this property object with the passed \a value.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be "OR"ed with the value of this property.
+     * @return The result of the "OR"ed operation.
+     * @remarks The value pointed by this property object is not changed in
+     * this operation.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator | (_Type_t value) const {
+        return (get() | value);
+    }
+    /*}}}*/
+    // _Value_t operator & (_Type_t value) const;/*{{{*/
+    /**
+     * Bitwise AND opeator.
+     * "AND" the value of this property object with the passed \a value.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be "AND"ed with the value of this property.
+     * @return The result of the "AND"ed operation.
+     * @remarks The value pointed by this property object is not changed in
+     * this operation.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator & (_Type_t value) const {
+        return (get() & value);
+    }
+    /*}}}*/
+    // _Value_t operator ^ (_Type_t value) const;/*{{{*/
+    /**
+     * Bitwise XOR opeator.
+     * "XOR" the value of this property object with the passed \a value.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be "XOR"ed with the value of this property.
+     * @return The result of the "XOR"ed operation.
+     * @remarks The value pointed by this property object is not changed in
+     * this operation.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator ^ (_Type_t value) const {
+        return (get() ^ value);
+    }
+    /*}}}*/
+    // _Value_t operator ~ () const;/*{{{*/
+    /**
+     * Bitwise NOT opeator.
+     * "NOT" the value of this property object.
+     * @return The result of the "NOT"ed operation.
+     * @since 1.0
+     **/
+    _Value_t operator ~ () const {
+        return ~get();
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Boolean Operators */ //@{
+    // bool operator ||(_Type_t value) const;/*{{{*/
+    /**
+     * Boolean "OR" operator.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be compared.
+     * @return A boolean value result of the comparison.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator ||(_Type_t value) const {
+        return (get() || value);
+    }
+    /*}}}*/
+    // bool operator &&(_Type_t value) const;/*{{{*/
+    /**
+     * Boolean "AND" operator.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be compared.
+     * @return A boolean value result of the comparison.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator &&(_Type_t value) const {
+        return (get() && value);
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** @name Disabled Constructor */ //@{
+    // PropertyT(const PropertyT<_Value_t> &other);/*{{{*/
+    /**
+     * Disabled copy constructor.
+     * @param other Another object to copy its values.
+     * @since 1.0
+     **/
+    PropertyT(const PropertyT<_Value_t> &other) {
+        other.get();
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Disabled Operators */ //@{
+    // void operator =(const PropertyT<_Value_t> &value);/*{{{*/
+    /**
+     * Assignment operator overloading.
+     * @param value Another property to get its value.
+     * @since 1.0
+     **/
+    void operator =(const PropertyT<_Value_t> &value) {
+        value.get();
+    }
+    /*}}}*/
+    // void operator =(const PropertyT<T> &value);/*{{{*/
+    /**
+     * The assignment operator is disabled.
+     * @since 1.0
+     **/
+    template <typename T>
+    void operator =(const PropertyT<T> &value) {
+        value.get();
+    }
+    /*}}}*/
+    //@}
+
+    // Typedefs
+    typedef _Value_t (*getfn_t)(void*);
+
+    // Static Functions
+    // static _Value_t getter(void *host) { }/*{{{*/
+    /**
+     * Calls the getter member function in \a host.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @returns The same value returned by the \a host member function \a
+     * _Method.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)()>
+    static _Value_t getter(void *host) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        return (p->*_Method)();
+    }
+    /*}}}*/
+    // static _Value_t constget(void *host) { }/*{{{*/
+    /**
+     * The invoker method.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)() const>
+    static _Value_t constget(void *host) {
+        _Host_t const *p = static_cast<_Host_t*>(host);
+        return (p->*_Method)();
+    }
+    /*}}}*/
+
+    // Data Members
+    void *m_host;           /**< Void pointer to the host object. */
+    getfn_t m_get;          /**< Getter function pointer.         */
+};
+
+/* Operators between property objects, declared in sstlprtr.hpp. */
+using sstl::operator ==;
+using sstl::operator !=;
+using sstl::operator < ;
+using sstl::operator <=;
+using sstl::operator > ;
+using sstl::operator >=;
+using sstl::operator + ;
+using sstl::operator - ;
+using sstl::operator * ;
+using sstl::operator / ;
+using sstl::operator | ;
+using sstl::operator & ;
+using sstl::operator ^ ;
+using sstl::operator ||;
+using sstl::operator &&;
+
+}   /* namespace ro */
+
+namespace sstl {
+/**
+ * Identifies `ro::PropertyT` for the property operators.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Value_t>
+struct PropertyTraitsT<ro::PropertyT<_Value_t> >
+{
+    static const bool is_property = true;  /**< Whether it is a property. */
+    static const bool is_rw = false;       /**< Whether it is `rw::PropertyT`. */
+    typedef _Value_t value_type;            /**< Type of the value.        */
+};
+}   /* namespace sstl */
+
+#endif /* __SSTLPRRO_HPP_DEFINED__ */
@@ -0,0 +1,333 @@
+/**
+ * @file
+ * Declares the rw::PropertyT class template.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLPRRW_HPP_DEFINED__
+#define __SSTLPRRW_HPP_DEFINED__
+
+#include "sstlprtr.hpp"
+
+namespace rw {
+/**
+ * Read write property class template.
+ * This object is able to mimic property like member variables in a class
+ * definition. The class doesn't hold the data of the property. Instead you
+ * must write getter and setter functions and \e bind them to the property
+ * object instance. This object is intended to be used for values like others
+ * object instances where usually the setter function has a different
+ * construction than the getter function. For example, suppose you have an
+ * object with a member of type `std::string`. A tipical getter function would
+ * return a copy of the internal member variable:
+ * `std::string getter() const`. But the setter function will require a const
+ * reference to another object: `void setter(const std::string&)`. This is
+ * common construction on getters and setters for object like data members.
+ * @tparam _Value_t The type of the value returned by the getter function.
+ * @tparam _Param_t The type of the parameter passed to the setter function.
+ * @since 1.0
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t, typename _Param_t>
+class PropertyT
+{
+public:
+    /** @name Constructor */ //@{
+    // PropertyT();/*{{{*/
+    /**
+     * Default constructor.
+     * @since 1.0
+     **/
+    PropertyT() : m_host(NULL), m_get(NULL), m_set(NULL) { }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void bind(_Host_t *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Getter Pointer to the getter function.
+     * @tparam _Setter Pointer to the setter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Getter)(), void (_Host_t::*_Setter)(_Param_t)>
+    void bind(_Host_t *host) {
+        m_host = (void *)host;
+        m_get  = &getter<_Host_t, _Getter>;
+        m_set  = &setter<_Host_t, _Setter>;
+    }
+    /*}}}*/
+    // void bind(_Host_t *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * This overloaded version is selected when the getter function is const.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Getter Pointer to the getter function.
+     * @tparam _Setter Pointer to the setter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Getter)() const, void (_Host_t::*_Setter)(_Param_t)>
+    void bind(_Host_t const *host) {
+        m_host = (void *)const_cast<_Host_t*>(host);
+        m_get  = &constget<_Host_t, _Getter>;
+        m_set  = &setter<_Host_t, _Setter>;
+    }
+    /*}}}*/
+    // void bind(_Host_t *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * This overloaded version is selected when the getter function is const.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Getter Pointer to the getter function.
+     * @tparam _Setter Pointer to the setter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Getter)() const, _Host_t& (_Host_t::*_Setter)(_Param_t)>
+    void bind(_Host_t const *host) {
+        m_host = (void *)const_cast<_Host_t*>(host);
+        m_get  = &constget<_Host_t, _Getter>;
+        m_set  = &setret<_Host_t, _Setter>;
+    }
+    /*}}}*/
+    // _Value_t get() const;/*{{{*/
+    /**
+     * Executes the getter function.
+     * @return The value returned by the getter function.
+     * @since 1.0
+     **/
+    _Value_t get() const { return (*m_get)(m_host); }
+    /*}}}*/
+    // void set(_Param_t value);/*{{{*/
+    /**
+     * Executes the setter function.
+     * @param value The value to be set.
+     * @since 1.0
+     **/
+    void set(_Param_t value) { (*m_set)(m_host, value); }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // operator _Value_t() const;/*{{{*/
+    /**
+     * Cast to type operator.
+     * This operator calls #get().
+     * @returns The value returned by the `%get()` function.
+     * @since 1.0
+     **/
+    operator _Value_t() const { return get(); }
+    /*}}}*/
+    // _Value_t operator ()() const;/*{{{*/
+    /**
+     * Functor operator.
+     * Calls the #get() function. This operator can be used in places where
+     * the compiler cannot deduce to use the `operator _Value_t()`.
+     * @return The value returned by `%get()`.
+     * @since 1.0
+     **/
+    _Value_t operator ()() const { return get(); }
+    /*}}}*/
+    // _Value_t operator =(_Param_t value);/*{{{*/
+    /**
+     * Assignment operator.
+     * This operator calls #set().
+     * @param value The value to be set.
+     * @since 1.0
+     **/
+    _Value_t operator =(_Param_t value) {
+        set(value); return get();
+    }
+    /*}}}*/
+    // _Value_t operator =(const PropertyT<_Value_t, _Param_t> &value);/*{{{*/
+    /**
+     * Assignment operator overloading.
+     * @param value Another property to get its value.
+     * @since 1.0
+     **/
+    _Value_t operator =(const PropertyT<_Value_t, _Param_t> &value) {
+        set(value.get()); return get();
+    }
+    /*}}}*/
+    // _Value_t operator =(const PropertyT<G, S> &value);/*{{{*/
+    /**
+     * Assignment operator.
+     * Copies the value of another property to this one.
+     * @param value Referece to another property object.
+     * @since 1.0
+     **/
+    template <typename G, typename S>
+    _Value_t operator =(const PropertyT<G, S> &value) {
+        set(value.get()); return get();
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Comparison Operators */ //@{
+    // bool operator ==(_Type_t value) const;/*{{{*/
+    /**
+     * Equality operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value The value to compare to. Must be implicitly convertible to
+     * the type of this property object.
+     * @return \b true if the passed \a value and the value pointed by this
+     * property are equals. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator ==(_Type_t value) const {
+        return (get() == value);
+    }
+    /*}}}*/
+    // bool operator !=(_Type_t value) const;/*{{{*/
+    /**
+     * Inequality operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @param value The value to compare to.
+     * @return \b true if the passed \a value and the value pointed by this
+     * property are different. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator !=(_Type_t value) const {
+        return (get() != value);
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** @name Disabled Constructor */ //@{
+    // PropertyT(const PropertyT<_Value_t, _Param_t> &other);/*{{{*/
+    /**
+     * Disabled copy constructor.
+     * @param other Another object to copy its values.
+     * @since 1.0
+     **/
+    PropertyT(const PropertyT<_Value_t, _Param_t> &other) {
+        other.get();
+    }
+    /*}}}*/
+    //@}
+
+    typedef _Value_t (*getfn_t)(void*);
+    typedef void (*setfn_t)(void*, _Param_t);
+
+    // Static Functions
+    // static _Value_t getter(void *host) { }/*{{{*/
+    /**
+     * Calls the getter member function in \a host.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @returns The same value returned by the \a host member function \a
+     * _Method.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)()>
+    static _Value_t getter(void *host) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        return (p->*_Method)();
+    }
+    /*}}}*/
+    // static _Value_t constget(void *host) { }/*{{{*/
+    /**
+     * Calls the getter member function in \a host.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @returns The same value returned by the \a host member function \a
+     * _Method.
+     * @remarks This overload is selected when the getter function is
+     * cv-qualified.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)() const>
+    static _Value_t constget(void *host) {
+        _Host_t const *p = static_cast<_Host_t*>(host);
+        return (p->*_Method)();
+    }
+    /*}}}*/
+    // static void setter(void *host, _Value_t value) { }/*{{{*/
+    /**
+     * Calls the setter member function in \a host.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @param value The value to pass to the member function.
+     * @since 1.0
+     **/
+    template <class _Host_t, void (_Host_t::*_Method)(_Param_t)>
+    static void setter(void *host, _Param_t value) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        (p->*_Method)(value);
+    }
+    /*}}}*/
+    // static void setret(void *host, _Value_t value) { }/*{{{*/
+    /**
+     * Calls the setter member function in \a host.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @param value The value to pass to the member function.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Host_t& (_Host_t::*_Method)(_Param_t)>
+    static void setret(void *host, _Param_t value) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        (p->*_Method)(value);
+    }
+    /*}}}*/
+
+    // Data Members
+    void *m_host;           /**< Void pointer to the host object. */
+    getfn_t m_get;          /**< Getter function pointer.         */
+    setfn_t m_set;          /**< Setter function pointer.         */
+};
+
+/* Operators between property objects, declared in sstlprtr.hpp. */
+using sstl::operator ==;
+using sstl::operator !=;
+using sstl::operator < ;
+using sstl::operator <=;
+using sstl::operator > ;
+using sstl::operator >=;
+using sstl::operator + ;
+using sstl::operator - ;
+using sstl::operator * ;
+using sstl::operator / ;
+using sstl::operator | ;
+using sstl::operator & ;
+using sstl::operator ^ ;
+using sstl::operator ||;
+using sstl::operator &&;
+
+}   /* namespace rw */
+
+namespace sstl {
+/**
+ * Identifies `rw::PropertyT` for the property operators.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Value_t, typename _Param_t>
+struct PropertyTraitsT<rw::PropertyT<_Value_t, _Param_t> >
+{
+    static const bool is_property = true;  /**< Whether it is a property. */
+    static const bool is_rw = true;        /**< Whether it is `rw::PropertyT`. */
+    typedef _Value_t value_type;            /**< Type of the value.        */
+};
+}   /* namespace sstl */
+
+#endif /* __SSTLPRRW_HPP_DEFINED__ */
@@ -0,0 +1,1044 @@
+/**
+ * @file
+ * Declares the ss::PropertyT class template.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLPRSS_HPP_DEFINED__
+#define __SSTLPRSS_HPP_DEFINED__
+
+#include "sstlprtr.hpp"
+
+namespace ss {
+/**
+ * A property like class template implementation.
+ * This object is able to mimic property like member variables in a class
+ * definition. The class doesn't hold the data of the property. Instead you
+ * must write getter and setter functions and \e bind them to the property
+ * object instance. This object has several overloaded operators and is
+ * intended to be used with scalar values.
+ *
+ * Values that are not small and trivially copyable are given to the setter
+ * by const reference, and rvalues can be moved into the setter. Compound
+ * assignment operators and `modify()` change the value in place when a
+ * reference accessor is bound through `access()`.
+ * @tparam _Value_t The type of the property value.
+ * @since 1.0
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+class PropertyT
+{
+public:
+    /** Type of the parameter of `set()`. Value or const reference. */
+    typedef typename sstl::ParamT<_Value_t>::type param_t;
+    /** Type of the rvalue parameter of `set()`. */
+    typedef typename sstl::ParamT<_Value_t>::move_type move_t;
+
+    /** @name Constructor */ //@{
+    // PropertyT() { }/*{{{*/
+    /**
+     * Default constructor.
+     * @since 1.0
+     **/
+    PropertyT() : m_host(NULL), m_get(NULL), m_set(NULL), m_move(NULL),
+        m_ref(NULL) { }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void bind(_Host_t *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Getter Pointer to the getter function.
+     * @tparam _Setter Pointer to the setter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Getter)(), void (_Host_t::*_Setter)(_Value_t)>
+    void bind(_Host_t *host) {
+        m_host = (void *)host;
+        m_get  = &getter<_Host_t, _Getter>;
+        m_set  = &setter<_Host_t, _Setter>;
+        m_move = &mover<_Host_t, _Setter>;
+    }
+    /*}}}*/
+    // void bind(_Host_t const *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * This overloaded version is selected when the getter function is const.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Getter Pointer to the getter function.
+     * @tparam _Setter Pointer to the setter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Getter)() const, void (_Host_t::*_Setter)(_Value_t)>
+    void bind(_Host_t const *host) {
+        m_host = (void *)const_cast<_Host_t*>(host);
+        m_get  = &constget<_Host_t, _Getter>;
+        m_set  = &setter<_Host_t, _Setter>;
+        m_move = &mover<_Host_t, _Setter>;
+    }
+    /*}}}*/
+    // void bind(_Host_t const *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * This overloaded version is selected when the getter function is const.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Getter Pointer to the getter function.
+     * @tparam _Setter Pointer to the setter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Getter)() const, _Host_t& (_Host_t::*_Setter)(_Value_t)>
+    void bind(_Host_t const *host) {
+        m_host = (void *)const_cast<_Host_t*>(host);
+        m_get  = &constget<_Host_t, _Getter>;
+        m_set  = &setret<_Host_t, _Setter>;
+        m_move = NULL;
+    }
+    /*}}}*/
+    // void bind(_Host_t const *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * This overloaded version is selected when the setter function receives
+     * a const reference.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Getter Pointer to the getter function.
+     * @tparam _Setter Pointer to the setter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Getter)() const, void (_Host_t::*_Setter)(const _Value_t&)>
+    void bind(_Host_t const *host) {
+        m_host = (void *)const_cast<_Host_t*>(host);
+        m_get  = &constget<_Host_t, _Getter>;
+        m_set  = &refsetter<_Host_t, _Setter>;
+        m_move = NULL;
+    }
+    /*}}}*/
+    // void bind(_Host_t const *host) { }/*{{{*/
+    /**
+     * Binds the property with the member functions in the host object.
+     * This overloaded version is selected when the setter function receives
+     * an rvalue reference. Lvalues are copied before being given to it.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Getter Pointer to the getter function.
+     * @tparam _Setter Pointer to the setter function.
+     * @param host Pointer to the instance of the host object.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Getter)() const, void (_Host_t::*_Setter)(_Value_t&&)>
+    void bind(_Host_t const *host) {
+        m_host = (void *)const_cast<_Host_t*>(host);
+        m_get  = &constget<_Host_t, _Getter>;
+        m_set  = &copysetter<_Host_t, _Setter>;
+        m_move = &movesetter<_Host_t, _Setter>;
+    }
+    /*}}}*/
+    // void access(_Host_t *host) { }/*{{{*/
+    /**
+     * Binds a member function giving direct access to the value.
+     * Used by `modify()` and the compound assignment operators to change the
+     * value in place, without copying it through the getter and the setter.
+     * Must be called after `bind()`, with the same host object.
+     * @tparam _Host_t Type of the host object.
+     * @tparam _Method Pointer to the member function returning a reference
+     * to the value.
+     * @param host Pointer to the instance of the host object.
+     * @remarks The setter is not called when the value is changed through
+     * this function.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t& (_Host_t::*_Method)()>
+    void access(_Host_t *host) {
+        m_host = (void *)host;
+        m_ref  = &reference<_Host_t, _Method>;
+    }
+    /*}}}*/
+    // _Value_t get() const;/*{{{*/
+    /**
+     * Executes the getter function.
+     * @return The value returned by the getter function.
+     * @since 1.0
+     **/
+    _Value_t get() const { return (*m_get)(m_host); }
+    /*}}}*/
+    // void set(param_t value);/*{{{*/
+    /**
+     * Executes the setter function.
+     * @param value The value to be set.
+     * @since 1.0
+     **/
+    void set(param_t value) { (*m_set)(m_host, value); }
+    /*}}}*/
+    // void set(move_t value);/*{{{*/
+    /**
+     * Executes the setter function moving the value.
+     * Selected for rvalues of types not passed by value. When the bound
+     * setter receives its parameter by value or by rvalue reference \a value
+     * is moved into it. Otherwise it is passed by const reference.
+     * @param value The value to be set.
+     * @since 1.2
+     **/
+    void set(move_t value) {
+        if (m_move) (*m_move)(m_host, std::move(value));
+        else (*m_set)(m_host, value);
+    }
+    /*}}}*/
+    // void modify(_Function_t fn);/*{{{*/
+    /**
+     * Changes the value in place.
+     * When a reference accessor is bound with `access()` \a fn receives the
+     * reference it returns and changes the value directly. Otherwise the
+     * value is read with the getter, changed by \a fn and moved into the
+     * setter.
+     * @tparam _Function_t Type of a callable receiving `_Value_t&`.
+     * @param fn The callable that changes the value.
+     * @par Example:
+     ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * object.names.modify([](std::vector<std::string> &list) {
+     *     list.push_back("another");
+     * });
+     ~~~~~~~~~~~~~~~~~~~~~
+     * @since 1.2
+     **/
+    template <typename _Function_t>
+    void modify(_Function_t fn) {
+        if (m_ref) {
+            fn((*m_ref)(m_host));
+        } else {
+            _Value_t value = get();
+            fn(value);
+            set(std::move(value));
+        }
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // operator _Value_t() const;/*{{{*/
+    /**
+     * Cast to type operator.
+     * This operator calls #get().
+     * @returns The value returned by the `%get()` function.
+     * @since 1.0
+     **/
+    operator _Value_t() const { return get(); }
+    /*}}}*/
+    // _Value_t operator ()() const;/*{{{*/
+    /**
+     * Functor operator.
+     * Calls the #get() function. This operator can be used in places where
+     * the compiler cannot deduce to use the `operator _Value_t()`.
+     * @return The value returned by `%get()`.
+     * @since 1.0
+     **/
+    _Value_t operator ()() const { return get(); }
+    /*}}}*/
+    // _Value_t operator =(param_t value);/*{{{*/
+    /**
+     * Assignment operator.
+     * This operator calls #set().
+     * @param value The value to be set.
+     * @since 1.0
+     **/
+    _Value_t operator =(param_t value) {
+        set(value); return get();
+    }
+    /*}}}*/
+    // _Value_t operator =(move_t value);/*{{{*/
+    /**
+     * Move assignment operator.
+     * This operator calls #set() moving \a value.
+     * @param value The value to be set.
+     * @since 1.2
+     **/
+    _Value_t operator =(move_t value) {
+        set(std::move(value)); return get();
+    }
+    /*}}}*/
+    // _Value_t operator =(const PropertyT<_Value_t> &value);/*{{{*/
+    /**
+     * Assignment operator overloading.
+     * @param value Another property to get its value.
+     * @since 1.0
+     **/
+    _Value_t operator =(const PropertyT<_Value_t> &value) {
+        set(value.get()); return get();
+    }
+    /*}}}*/
+    // _Value_t operator =(const PropertyT<T> &value);/*{{{*/
+    /**
+     * Assignment operator.
+     * Copies the value of another property to this one.
+     * @tparam T Type of the \a value property. This doesn't need to be
+     * defined. The compiler will deduce it.
+     * @param value Another property object reference. Can be of another type.
+     * But the type must be implicity convertible to the type of this object.
+     * @since 1.0
+     **/
+    template <typename T>
+    _Value_t operator =(const PropertyT<T> &value) {
+        set(value.get()); return get();
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Comparison Operators */ //@{
+    // bool operator ! () const;/*{{{*/
+    /**
+     * Negation operator.
+     * @returns \b true when the value of this property can be convertibal to
+     * a \b falsy result. \b false otherwise.
+     * @since 1.0
+     **/
+    bool operator ! () const {
+        return !bool(get());
+    }
+    /*}}}*/
+    // bool operator ==(_Type_t value) const;/*{{{*/
+    /**
+     * Equality operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value The value to compare to. Must be implicitly convertible to
+     * the type of this property object.
+     * @return \b true if the passed \a value and the value pointed by this
+     * property are equals. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator ==(_Type_t value) const {
+        return (get() == value);
+    }
+    /*}}}*/
+    // bool operator !=(_Type_t value) const;/*{{{*/
+    /**
+     * Inequality operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @param value The value to compare to.
+     * @return \b true if the passed \a value and the value pointed by this
+     * property are different. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator !=(_Type_t value) const {
+        return (get() != value);
+    }
+    /*}}}*/
+    // bool operator < (_Type_t value) const;/*{{{*/
+    /**
+     * Less than operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @param value The value to compare to.
+     * @return \b true when the value returned by this property object is
+     * \it{less than} the passed \a value. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator < (_Type_t value) const {
+        return (get() < value);
+    }
+    /*}}}*/
+    // bool operator <=(_Type_t value) const;/*{{{*/
+    /**
+     * Less than or equal operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @param value The value to compare to.
+     * @return \b true when the value returned by this property object is
+     * \it{less than or equal} the passed \a value. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator <=(_Type_t value) const {
+        return (get() <= value);
+    }
+    /*}}}*/
+    // bool operator > (_Type_t value) const;/*{{{*/
+    /**
+     * Greater than operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @param value The value to compare to.
+     * @return \b true when the value returned by this property object is
+     * \it{greater than} the passed \a value. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator > (_Type_t value) const {
+        return (get() > value);
+    }
+    /*}}}*/
+    // bool operator >=(_Type_t value) const;/*{{{*/
+    /**
+     * Greater than or equal operator.
+     * Compares the value of the property pointed by this object with the
+     * passed value.
+     * @param value The value to compare to.
+     * @return \b true when the value returned by this property object is
+     * \it{greater than or equal} the passed \a value. \b false otherwise.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator >=(_Type_t value) const {
+        return (get() >= value);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Mathematical Operators */ //@{
+    // _Value_t operator + (_Type_t value) const;/*{{{*/
+    /**
+     * Addition operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator doesn't change the value of the property pointed
+     * by this object neither the value of the \a value parameter. Just the
+     * operation is done and the resulting value will be returned.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator + (_Type_t value) const {
+        return (get() + value);
+    }
+    /*}}}*/
+    // _Value_t operator - (_Type_t value) const;/*{{{*/
+    /**
+     * Subtraction operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator doesn't change the value of the property pointed
+     * by this object neither the value of the \a value parameter. Just the
+     * operation is done and the resulting value will be returned.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator - (_Type_t value) const {
+        return (get() - value);
+    }
+    /*}}}*/
+    // _Value_t operator * (_Type_t value) const;/*{{{*/
+    /**
+     * Multiplication operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator doesn't change the value of the property pointed
+     * by this object neither the value of the \a value parameter. Just the
+     * operation is done and the resulting value will be returned.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator * (_Type_t value) const {
+        return (get() * value);
+    }
+    /*}}}*/
+    // _Value_t operator / (_Type_t value) const;/*{{{*/
+    /**
+     * Division operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator doesn't change the value of the property pointed
+     * by this object neither the value of the \a value parameter. Just the
+     * operation is done and the resulting value will be returned.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator / (_Type_t value) const {
+        return (get() / value);
+    }
+    /*}}}*/
+    // _Value_t operator +=(const _Type_t &value);/*{{{*/
+    /**
+     * Addition operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator changes the value of the property pointed by
+     * this object adding the \a value parameter.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator +=(const _Type_t &value) {
+        return update([&value](_Value_t &v) { v += value; });
+    }
+    /*}}}*/
+    // _Value_t operator -=(const _Type_t &value);/*{{{*/
+    /**
+     * Subtraction operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator changes the value of the property pointed by
+     * this object adding the \a value parameter.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator -=(const _Type_t &value) {
+        return update([&value](_Value_t &v) { v -= value; });
+    }
+    /*}}}*/
+    // _Value_t operator *=(const _Type_t &value);/*{{{*/
+    /**
+     * Multiplication operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator changes the value of the property pointed by
+     * this object adding the \a value parameter.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator *=(const _Type_t &value) {
+        return update([&value](_Value_t &v) { v *= value; });
+    }
+    /*}}}*/
+    // _Value_t operator /=(const _Type_t &value);/*{{{*/
+    /**
+     * Division operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator changes the value of the property pointed by
+     * this object adding the \a value parameter.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator /=(const _Type_t &value) {
+        return update([&value](_Value_t &v) { v /= value; });
+    }
+    /*}}}*/
+    // _Value_t operator +=(const PropertyT<_Type_t> &value);/*{{{*/
+    /**
+     * Addition operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Another property object with the value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator changes the value of the property pointed by
+     * this object adding the \a value parameter.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator +=(const PropertyT<_Type_t> &value) {
+        return update([&value](_Value_t &v) { v += value.get(); });
+    }
+    /*}}}*/
+    // _Value_t operator -=(const PropertyT<_Type_t> &value);/*{{{*/
+    /**
+     * Subtraction operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Another property object with the value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator changes the value of the property pointed by
+     * this object adding the \a value parameter.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator -=(const PropertyT<_Type_t> &value) {
+        return update([&value](_Value_t &v) { v -= value.get(); });
+    }
+    /*}}}*/
+    // _Value_t operator *=(const PropertyT<_Type_t> &value);/*{{{*/
+    /**
+     * Multiplication operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Another property object with the value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator changes the value of the property pointed by
+     * this object adding the \a value parameter.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator *=(const PropertyT<_Type_t> &value) {
+        return update([&value](_Value_t &v) { v *= value.get(); });
+    }
+    /*}}}*/
+    // _Value_t operator /=(const PropertyT<_Type_t> &value);/*{{{*/
+    /**
+     * Division operator.
+     * @tparam _Type_t Data type of the value to be compared. This doesn't
+     * need to be informed. The compiler can deduce the type by the passed
+     * value.
+     * @param value Another property object with the value to be added.
+     * @return The value resulting of the mathematical operation.
+     * @remarks This operator changes the value of the property pointed by
+     * this object adding the \a value parameter.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator /=(const PropertyT<_Type_t> &value) {
+        return update([&value](_Value_t &v) { v /= value.get(); });
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Bitwise Operators */ //@{
+    // _Value_t operator | (_Type_t value) const;/*{{{*/
+    /**
+     * Bitwise OR opeator.
+     * "OR" the value of this property object with the passed \a value.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be "OR"ed with the value of this property.
+     * @return The result of the "OR"ed operation.
+     * @remarks The value pointed by this property object is not changed in
+     * this operation.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator | (_Type_t value) const {
+        return (get() | value);
+    }
+    /*}}}*/
+    // _Value_t operator & (_Type_t value) const;/*{{{*/
+    /**
+     * Bitwise AND opeator.
+     * "AND" the value of this property object with the passed \a value.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be "AND"ed with the value of this property.
+     * @return The result of the "AND"ed operation.
+     * @remarks The value pointed by this property object is not changed in
+     * this operation.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator & (_Type_t value) const {
+        return (get() & value);
+    }
+    /*}}}*/
+    // _Value_t operator ^ (_Type_t value) const;/*{{{*/
+    /**
+     * Bitwise XOR opeator.
+     * "XOR" the value of this property object with the passed \a value.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be "XOR"ed with the value of this property.
+     * @return The result of the "XOR"ed operation.
+     * @remarks The value pointed by this property object is not changed in
+     * this operation.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, _Value_t>::type operator ^ (_Type_t value) const {
+        return (get() ^ value);
+    }
+    /*}}}*/
+    // _Value_t operator ~ () const;/*{{{*/
+    /**
+     * Bitwise NOT opeator.
+     * "NOT" the value of this property object.
+     * @return The result of the "NOT"ed operation.
+     * @since 1.0
+     **/
+    _Value_t operator ~ () const {
+        return ~get();
+    }
+    /*}}}*/
+    // _Value_t operator |=(const _Type_t &value);/*{{{*/
+    /**
+     * Bitwise OR opeator.
+     * "OR" the value of this property object with the passed \a value.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be "OR"ed with the value of this property.
+     * @return The result of the "OR"ed operation.
+     * @remarks The value pointed by this property object is changed and,
+     * then, returned by this operation.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator |=(const _Type_t &value) {
+        return update([&value](_Value_t &v) { v |= value; });
+    }
+    /*}}}*/
+    // _Value_t operator &=(const _Type_t &value);/*{{{*/
+    /**
+     * Bitwise AND opeator.
+     * "AND" the value of this property object with the passed \a value.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be "AND"ed with the value of this property.
+     * @return The result of the "AND"ed operation.
+     * @remarks The value pointed by this property object is changed and,
+     * then, returned by this operation.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator &=(const _Type_t &value) {
+        return update([&value](_Value_t &v) { v &= value; });
+    }
+    /*}}}*/
+    // _Value_t operator ^=(const _Type_t &value);/*{{{*/
+    /**
+     * Bitwise XOR opeator.
+     * "XOR" the value of this property object with the passed \a value.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be "XOR"ed with the value of this property.
+     * @return The result of the "XOR"ed operation.
+     * @remarks The value pointed by this property object is changed and,
+     * then, returned by this operation.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator ^=(const _Type_t &value) {
+        return update([&value](_Value_t &v) { v ^= value; });
+    }
+    /*}}}*/
+    // _Value_t operator |=(const PropertyT<_Type_t> &value);/*{{{*/
+    /**
+     * Bitwise OR opeator.
+     * "OR" the value of this property object with the passed \a value.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value Another PropertyT object with the value to be "OR"ed with
+     * the value of this property.
+     * @return The result of the "OR"ed operation.
+     * @remarks The value pointed by this property object is changed in
+     * this operation and, them, returned.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator |=(const PropertyT<_Type_t> &value) {
+        return update([&value](_Value_t &v) { v |= value.get(); });
+    }
+    /*}}}*/
+    // _Value_t operator &=(const PropertyT<_Type_t> &value);/*{{{*/
+    /**
+     * Bitwise AND opeator.
+     * "AND" the value of this property object with the passed \a value.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value Another PropertyT object with the value to be "AND"ed with
+     * the value of this property.
+     * @return The result of the "AND"ed operation.
+     * @remarks The value pointed by this property object is changed in
+     * this operation and, them, returned.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator &=(const PropertyT<_Type_t> &value) {
+        return update([&value](_Value_t &v) { v &= value.get(); });
+    }
+    /*}}}*/
+    // _Value_t operator ^=(const PropertyT<_Type_t> &value);/*{{{*/
+    /**
+     * Bitwise XOR opeator.
+     * "XOR" the value of this property object with the passed \a value.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value Another PropertyT object with the value to be "XOR"ed with
+     * the value of this property.
+     * @return The result of the "XOR"ed operation.
+     * @remarks The value pointed by this property object is changed in
+     * this operation and, them, returned.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    _Value_t operator ^=(const PropertyT<_Type_t> &value) {
+        return update([&value](_Value_t &v) { v ^= value.get(); });
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Boolean Operators */ //@{
+    // bool operator ||(_Type_t value) const;/*{{{*/
+    /**
+     * Boolean "OR" operator.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be compared.
+     * @return A boolean value result of the comparison.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator ||(_Type_t value) const {
+        return (get() || _Value_t(value));
+    }
+    /*}}}*/
+    // bool operator &&(_Type_t value) const;/*{{{*/
+    /**
+     * Boolean "AND" operator.
+     * @tparam _Type_t Data type of the passed parameter. This doesn't need to
+     * be informed. The compiler can deduce the type by the passed value.
+     * @param value The value to be compared.
+     * @return A boolean value result of the comparison.
+     * @since 1.0
+     **/
+    template <typename _Type_t>
+    typename sstl::IfValueT<_Type_t, bool>::type operator &&(_Type_t value) const {
+        return (get() && _Value_t(value));
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** @name Disabled Constructor */ //@{
+    // PropertyT(const PropertyT<_Value_t> &other);/*{{{*/
+    /**
+     * Disabled copy constructor.
+     * @param other Another object to copy its values.
+     * @since 1.0
+     **/
+    PropertyT(const PropertyT<_Value_t> &other) {
+        other.get();
+    }
+    /*}}}*/
+    //@}
+
+    typedef _Value_t (*getfn_t)(void*);
+    typedef void (*setfn_t)(void*, param_t);
+    typedef void (*movefn_t)(void*, _Value_t&&);
+    typedef _Value_t& (*reffn_t)(void*);
+
+    // _Value_t update(_Function_t fn);/*{{{*/
+    /**
+     * Implements the compound assignment operators.
+     * Same as `modify()`, returning the value of the property.
+     * @returns The value after the change. Without a reference accessor it
+     * is read back with the getter, so changes made by the setter, like a
+     * clamp, are returned too.
+     * @since 1.2
+     **/
+    template <typename _Function_t>
+    _Value_t update(_Function_t fn) {
+        if (m_ref) {
+            _Value_t &value = (*m_ref)(m_host);
+            fn(value);
+            return value;
+        }
+        _Value_t value = get();
+        fn(value);
+        set(std::move(value));
+        return get();
+    }
+    /*}}}*/
+
+    // Static Functions
+    // static _Value_t getter(void *host) { }/*{{{*/
+    /**
+     * Calls the getter member function in \a host.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @returns The same value returned by the \a host member function \a
+     * _Method.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)()>
+    static _Value_t getter(void *host) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        return (p->*_Method)();
+    }
+    /*}}}*/
+    // static _Value_t constget(void *host) { }/*{{{*/
+    /**
+     * Calls the getter member function in \a host.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @returns The same value returned by the \a host member function \a
+     * _Method.
+     * @remarks This overload is selected when the getter function is
+     * cv-qualified.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Value_t (_Host_t::*_Method)() const>
+    static _Value_t constget(void *host) {
+        _Host_t const *p = static_cast<_Host_t*>(host);
+        return (p->*_Method)();
+    }
+    /*}}}*/
+    // static void setter(void *host, param_t value) { }/*{{{*/
+    /**
+     * Calls the setter member function in \a host.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @param value The value to pass to the member function.
+     * @since 1.0
+     **/
+    template <class _Host_t, void (_Host_t::*_Method)(_Value_t)>
+    static void setter(void *host, param_t value) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        (p->*_Method)(value);
+    }
+    /*}}}*/
+    // static void mover(void *host, _Value_t &&value) { }/*{{{*/
+    /**
+     * Calls the setter member function in \a host moving the value into its
+     * parameter.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @param value The value to pass to the member function.
+     * @since 1.2
+     **/
+    template <class _Host_t, void (_Host_t::*_Method)(_Value_t)>
+    static void mover(void *host, _Value_t &&value) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        (p->*_Method)(std::move(value));
+    }
+    /*}}}*/
+    // static void refsetter(void *host, param_t value) { }/*{{{*/
+    /**
+     * Calls the setter member function, receiving a const reference, in \a
+     * host.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @param value The value to pass to the member function.
+     * @since 1.2
+     **/
+    template <class _Host_t, void (_Host_t::*_Method)(const _Value_t&)>
+    static void refsetter(void *host, param_t value) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        (p->*_Method)(value);
+    }
+    /*}}}*/
+    // static void copysetter(void *host, param_t value) { }/*{{{*/
+    /**
+     * Calls the setter member function, receiving an rvalue reference, in
+     * \a host with a copy of \a value.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @param value The value to pass to the member function.
+     * @since 1.2
+     **/
+    template <class _Host_t, void (_Host_t::*_Method)(_Value_t&&)>
+    static void copysetter(void *host, param_t value) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        _Value_t copy(value);
+        (p->*_Method)(std::move(copy));
+    }
+    /*}}}*/
+    // static void movesetter(void *host, _Value_t &&value) { }/*{{{*/
+    /**
+     * Calls the setter member function, receiving an rvalue reference, in
+     * \a host.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @param value The value to pass to the member function.
+     * @since 1.2
+     **/
+    template <class _Host_t, void (_Host_t::*_Method)(_Value_t&&)>
+    static void movesetter(void *host, _Value_t &&value) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        (p->*_Method)(std::move(value));
+    }
+    /*}}}*/
+    // static _Value_t& reference(void *host) { }/*{{{*/
+    /**
+     * Calls the reference accessor member function in \a host.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @returns The reference returned by the member function.
+     * @since 1.2
+     **/
+    template <class _Host_t, _Value_t& (_Host_t::*_Method)()>
+    static _Value_t& reference(void *host) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        return (p->*_Method)();
+    }
+    /*}}}*/
+    // static void setret(void *host, param_t value) { }/*{{{*/
+    /**
+     * Calls the setter member function in \a host.
+     * @tparam _Host_t The type of the host object.
+     * @tparam _Method The member function to call.
+     * @param host Pointer to the host instance.
+     * @param value The value to pass to the member function.
+     * @since 1.0
+     **/
+    template <class _Host_t, _Host_t& (_Host_t::*_Method)(_Value_t)>
+    static void setret(void *host, param_t value) {
+        _Host_t *p = static_cast<_Host_t*>(host);
+        (p->*_Method)(value);
+    }
+    /*}}}*/
+
+    // Data Members
+    void *m_host;           /**< Void pointer to the host object. */
+    getfn_t m_get;          /**< Getter function pointer.         */
+    setfn_t m_set;          /**< Setter function pointer.         */
+    movefn_t m_move;        /**< Moving setter function pointer.  */
+    reffn_t m_ref;          /**< Reference accessor pointer.      */
+};
+
+/* Operators between property objects, declared in sstlprtr.hpp. */
+using sstl::operator ==;
+using sstl::operator !=;
+using sstl::operator < ;
+using sstl::operator <=;
+using sstl::operator > ;
+using sstl::operator >=;
+using sstl::operator + ;
+using sstl::operator - ;
+using sstl::operator * ;
+using sstl::operator / ;
+using sstl::operator | ;
+using sstl::operator & ;
+using sstl::operator ^ ;
+using sstl::operator ||;
+using sstl::operator &&;
+
+}   /* namespace ss */
+
+namespace sstl {
+/**
+ * Identifies `ss::PropertyT` for the property operators.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Value_t>
+struct PropertyTraitsT<ss::PropertyT<_Value_t> >
+{
+    static const bool is_property = true;  /**< Whether it is a property. */
+    static const bool is_rw = false;       /**< Whether it is `rw::PropertyT`. */
+    typedef _Value_t value_type;            /**< Type of the value.        */
+};
+}   /* namespace sstl */
+
+#endif /* __SSTLPRSS_HPP_DEFINED__ */
@@ -0,0 +1,342 @@
+/**
+ * @file
+ * Declares the support templates shared by the property classes.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLPRTR_HPP_DEFINED__
+#define __SSTLPRTR_HPP_DEFINED__
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace sstl {
+/**
+ * Selects how property values are passed to setter functions.
+ * Small trivially copyable types, like scalars and small aggregates, are
+ * passed by value. Any other type is passed by const reference, avoiding
+ * deep copies of strings, vectors and other types that own resources.
+ * @tparam _Value_t The type of the property value.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Value_t>
+struct ParamT
+{
+    /** Placeholder for operations that make no sense for the type. */
+    struct none_t { };
+
+    /** Whether \a _Value_t is passed by value. */
+    static const bool by_value = std::is_trivially_copyable<_Value_t>::value &&
+        (sizeof(_Value_t) <= (2 * sizeof(void *)));
+
+    /** Type of the parameter passed to setters. */
+    typedef typename std::conditional<by_value, _Value_t, const _Value_t&>::type type;
+
+    /** Type used to move values into setters. Disabled when passed by value. */
+    typedef typename std::conditional<by_value, none_t, _Value_t>::type&& move_type;
+};
+
+/**
+ * Identifies the property classes.
+ * Specialized by `ss::PropertyT`, `rw::PropertyT` and `ro::PropertyT`. Any
+ * other type is a plain value.
+ * @tparam _Type_t The type to check.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ *//* --------------------------------------------------------------------- */
+template <typename _Type_t>
+struct PropertyTraitsT
+{
+    static const bool is_property = false;  /**< Whether it is a property. */
+    static const bool is_rw = false;        /**< Whether it is `rw::PropertyT`. */
+    typedef _Type_t value_type;             /**< Type of the value.        */
+};
+
+/**
+ * Type of the result of the arithmetic and bitwise property operators.
+ * It is the value type of \a _Left_t, unless only \a _Left_t is a
+ * `rw::PropertyT`. Then it is the value type of \a _Right_t. This is the
+ * rule of the operators of each pair of property classes of version 1.0.
+ * @tparam _Left_t Type of the left operand.
+ * @tparam _Right_t Type of the right operand.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+struct ResultT
+{
+    /** The result type. */
+    typedef typename std::conditional<PropertyTraitsT<_Left_t>::is_rw &&
+                                      !PropertyTraitsT<_Right_t>::is_rw,
+                                      typename PropertyTraitsT<_Right_t>::value_type,
+                                      typename PropertyTraitsT<_Left_t>::value_type>::type type;
+};
+
+/**
+ * Enables member operators of property classes for plain values only.
+ * Operands that are properties are handled by the non-member operators.
+ * @tparam _Type_t Type of the operand.
+ * @tparam _Result_t Result of the operator.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Type_t, typename _Result_t>
+struct IfValueT : std::enable_if<!PropertyTraitsT<_Type_t>::is_property, _Result_t> { };
+
+/**
+ * Enables the non-member operators when both operands are properties.
+ * Empty otherwise, removing the operators from the overload set.
+ * @tparam _Left_t Type of the left operand.
+ * @tparam _Right_t Type of the right operand.
+ * @tparam _Result_t Result of the operator.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t, typename _Result_t>
+struct IfPropertiesT : std::enable_if<PropertyTraitsT<_Left_t>::is_property &&
+                                      PropertyTraitsT<_Right_t>::is_property, _Result_t> { };
+
+// Operators/*{{{*/
+/**
+ * Equality operator.
+ * A single set of operators serves any combination of `ss::PropertyT`,
+ * `rw::PropertyT` and `ro::PropertyT` objects. They are brought into the
+ * namespace of each property class by using declarations, so they are found
+ * by argument dependent lookup. The operators apply only when both operands
+ * are properties. The values of both must be implicitly convertible.
+ * @param left The property to compare to.
+ * @param right The property to compare with.
+ * @return \b true if both properties have equal values.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, bool>::type operator ==(const _Left_t &left, const _Right_t &right) {
+    return (left.get() == right.get());
+}
+/**
+ * Inequality operator.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, bool>::type operator !=(const _Left_t &left, const _Right_t &right) {
+    return (left.get() != right.get());
+}
+/**
+ * Less than operator.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, bool>::type operator < (const _Left_t &left, const _Right_t &right) {
+    return (left.get() < right.get());
+}
+/**
+ * Less than or equal operator.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, bool>::type operator <=(const _Left_t &left, const _Right_t &right) {
+    return (left.get() <= right.get());
+}
+/**
+ * Greater than operator.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, bool>::type operator > (const _Left_t &left, const _Right_t &right) {
+    return (left.get() > right.get());
+}
+/**
+ * Greater than or equal operator.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, bool>::type operator >=(const _Left_t &left, const _Right_t &right) {
+    return (left.get() >= right.get());
+}
+/**
+ * Addition operator.
+ * @return The result has the type given by `sstl::ResultT`.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, typename ResultT<_Left_t, _Right_t>::type>::type
+operator + (const _Left_t &left, const _Right_t &right) {
+    return (left.get() + right.get());
+}
+/**
+ * Subtraction operator.
+ * @return The result has the type given by `sstl::ResultT`.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, typename ResultT<_Left_t, _Right_t>::type>::type
+operator - (const _Left_t &left, const _Right_t &right) {
+    return (left.get() - right.get());
+}
+/**
+ * Multiplication operator.
+ * @return The result has the type given by `sstl::ResultT`.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, typename ResultT<_Left_t, _Right_t>::type>::type
+operator * (const _Left_t &left, const _Right_t &right) {
+    return (left.get() * right.get());
+}
+/**
+ * Division operator.
+ * @return The result has the type given by `sstl::ResultT`.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, typename ResultT<_Left_t, _Right_t>::type>::type
+operator / (const _Left_t &left, const _Right_t &right) {
+    return (left.get() / right.get());
+}
+/**
+ * Bitwise OR operator.
+ * @return The result has the type given by `sstl::ResultT`.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, typename ResultT<_Left_t, _Right_t>::type>::type
+operator | (const _Left_t &left, const _Right_t &right) {
+    return (left.get() | right.get());
+}
+/**
+ * Bitwise AND operator.
+ * @return The result has the type given by `sstl::ResultT`.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, typename ResultT<_Left_t, _Right_t>::type>::type
+operator & (const _Left_t &left, const _Right_t &right) {
+    return (left.get() & right.get());
+}
+/**
+ * Bitwise exclusive OR operator.
+ * @return The result has the type given by `sstl::ResultT`.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, typename ResultT<_Left_t, _Right_t>::type>::type
+operator ^ (const _Left_t &left, const _Right_t &right) {
+    return (left.get() ^ right.get());
+}
+/**
+ * Logical OR operator.
+ * @remarks Both operands are evaluated.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, bool>::type operator ||(const _Left_t &left, const _Right_t &right) {
+    return (left.get() || right.get());
+}
+/**
+ * Logical AND operator.
+ * @remarks Both operands are evaluated.
+ * @since 1.2
+ * @ingroup sstl_properties_operators
+ **/
+template <typename _Left_t, typename _Right_t>
+typename IfPropertiesT<_Left_t, _Right_t, bool>::type operator &&(const _Left_t &left, const _Right_t &right) {
+    return (left.get() && right.get());
+}
+/*}}}*/
+}   /* namespace sstl */
+
+// #define ssplink(_Property_, _Pointer_, _Type_, _Getter_, _Setter_) \/*{{{*/
+/**
+ * Links getter and setter functions to a `ss::PropertyT` object.
+ * @param _Property_ The property object instance.
+ * @param _Pointer_ Pointer to the class instance defining the getter and
+ * setter member functions.
+ * @param _Type_ Type of the object pointed by \a _Pointer_.
+ * @param _Getter_ Name of the getter member function. Just the name.
+ * @param _Setter_ Name of the setter member function. Just the name.
+ * @remarks This macro constructs the call to `ss::PropertyT::bind()` function
+ * packing the passed parameters. An example explains better how to use this
+ * macro:
+ * ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * class MyObject {
+ * public:
+ *     ss::PropertyT<int> intProperty;
+ *
+ *     MyObject() {
+ *         ssplink(intProperty, this, MyObject, get_int, set_int);
+ *         // This will print the code:
+ *         intProperty.bind<MyObject, &MyObject::get_int, &MyObject::set_int>(this);
+ *     }
+ * private:
+ *     int get_int() const {
+ *         return m_intMember;
+ *     }
+ *     void set_int(int val) {
+ *         m_intMember = val;
+ *     }
+ *     int m_intMember;
+ * };
+ * ~~~~~~~~~~~~~~~~~~~~~
+ * This macro works for both `ss::PropertyT` and `rw::PropertyT` properties
+ * objects.
+ * @since 1.0
+ **/
+#define ssplink(_Property_, _Pointer_, _Type_, _Getter_, _Setter_) \
+    _Property_.bind<_Type_, &_Type_::_Getter_, &_Type_::_Setter_>(_Pointer_)
+/*}}}*/
+// #define GS(_Class_t, _GetterFn, _SetterFn)  _Class_t, & _Class_t :: _GetterFn, & _Class_t :: _SetterFn/*{{{*/
+/**
+ * Macro to help pass arguments to `ss::PropertyT` and `rw::PropertyT`
+ * objects.
+ * @param _Class_t Type of the class holding the getter and setter functions.
+ * @param _GetterFn Name of the getter member function.
+ * @param _SetterFn Name of the setter member function.
+ * @remarks The macro expands its arguments in a way that they will fit in the
+ * list of template parameter of the functions `bind()`. This macro can be
+ * used in the following way:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * class MyObject {
+ * public:
+ *     ss::PropertyT<int> count;
+ *
+ *     MyObject();
+ *
+ * private:
+ *     int getCount() const;
+ *     void setCount(int value);
+ * };
+ *
+ * // In the implementation of the constructor:
+ * MyObject::MyObject() {
+ *     count.bind< GS(MyObject, getCount, setCount) >(this);
+ * }
+ ~~~~~~~~~~~~~~~~~~~~~
+ * The example shows usage with `ss::PropertyT` class but it is also valid for
+ * `rw::PropertyT` classes.
+ * @note \b GS stands for \bf{G}etter and \bf{S}etter.
+ * @since 1.0
+ **/
+#define GS(_Class_t, _GetterFn, _SetterFn)  _Class_t, & _Class_t :: _GetterFn, & _Class_t :: _SetterFn
+/*}}}*/
+
+#endif /* __SSTLPRTR_HPP_DEFINED__ */
@@ -0,0 +1,314 @@
+/**
+ * @file
+ * Declares the ss::EventQueueT class template.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLQUEU_HPP_DEFINED__
+#define __SSTLQUEU_HPP_DEFINED__
+
+#if (__cplusplus < 201103L) && (!defined(_MSC_VER) || (_MSC_VER < 1800))
+#error "sstlqueu.hpp requires a C++11 compiler"
+#endif
+
+#include <cstddef>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "sstleven.hpp"
+
+namespace ss {
+
+/**
+ * Queue of deferred event notifications.
+ * Allows an event to be fired from any number of threads (producers) and
+ * delivered in a single thread (the consumer). Producers call `post()`,
+ * that copies the arguments into a preallocated ring buffer. The consumer
+ * thread calls `drain()` that triggers the target event once for each
+ * queued notification, in the order they were posted.
+ *
+ * The ring buffer is a bounded lock-free queue. Its capacity is defined in
+ * the constructor and never changes. `post()` never blocks and the queue
+ * doesn't allocate memory after construction. Copying the arguments still
+ * can, like for a `std::string`. When the queue is full `post()` fails
+ * returning \b false.
+ * @tparam _Signature_t The signature of the event. Example:
+ * `EventQueueT<void(int, const std::string&)>`. Arguments are stored by
+ * value, that is, for the example above a copy of the `std::string` is kept
+ * until the notification is delivered.
+ * @tparam _Event_t The type of the event that delivers the notifications.
+ * Defaults to `ss::EventT<_Signature_t>`. Can be any type with a compatible
+ * `trigger()` function, like `ss::ConcurrentEventT`.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * ss::EventT<void(int)> onData;
+ * ss::EventQueueT<void(int)> queue(&onData, 1024);
+ *
+ * // In any producer thread:
+ * if (!queue.post(42))
+ *     // Queue full.
+ *
+ * // In the consumer thread loop:
+ * queue.drain(64);     // Delivers up to 64 notifications.
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @note Only one thread can call `drain()`. A call from inside a delegate
+ * run by `drain()` does nothing. Requires C++11.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Signature_t, class _Event_t = EventT<_Signature_t> >
+class EventQueueT;
+
+/**
+ * Event queue for functions with any number of arguments.
+ * @tparam _Return_t The return type of the function. Should be void.
+ * @tparam _Args_t Types of the function parameters.
+ * @tparam _Event_t The type of the target event.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Return_t, typename... _Args_t, class _Event_t>
+class EventQueueT<_Return_t (_Args_t...), _Event_t>
+{
+public:
+    /** Type of the target event. */
+    typedef _Event_t event_t;
+
+    /** @name Constructors & Destructor */ //@{
+    // EventQueueT(event_t *target, size_t capacity);/*{{{*/
+    /**
+     * Builds the queue.
+     * @param target Pointer to the event that will deliver the queued
+     * notifications. Must remain valid while this queue exists.
+     * @param capacity Maximum number of pending notifications. Rounded up to
+     * a power of two. This is the only moment this object allocates memory.
+     * @since 1.2
+     **/
+    EventQueueT(event_t *target, size_t capacity) : m_target(target),
+        m_cells(NULL), m_mask(0), m_draining(false), m_head(0), m_tail(0)
+    {
+        size_t size = 2;
+        while (size < capacity) size *= 2;
+
+        m_cells = new cell_t[size];
+        m_mask  = size - 1;
+        for (size_t i = 0; i < size; ++i)
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    /*}}}*/
+    // ~EventQueueT();/*{{{*/
+    /**
+     * Destructor.
+     * Pending notifications are discarded without being delivered.
+     * @since 1.2
+     **/
+    ~EventQueueT() {
+        while (cell_t *cell = front()) pop(cell);
+        delete[] m_cells;
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // size_t capacity() const;/*{{{*/
+    /**
+     * Retrieves the maximum number of pending notifications.
+     * @since 1.2
+     **/
+    size_t capacity() const { return (m_mask + 1); }
+    /*}}}*/
+    // size_t pending() const;/*{{{*/
+    /**
+     * Retrieves the number of pending notifications.
+     * @return The approximated number of notifications waiting to be
+     * delivered. Exact only when no producer is running.
+     * @since 1.2
+     **/
+    size_t pending() const {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        return ((tail > head) ? (tail - head) : 0);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // bool post(_Params_t&&... args);/*{{{*/
+    /**
+     * Queues a notification.
+     * Can be called from any thread.
+     * @param args Arguments to pass to the event when the notification is
+     * delivered. They are copied (or moved) into the queue.
+     * @return \b true when the notification was queued. \b false when the
+     * queue is full.
+     * @remarks When copying the arguments throws, the exception is passed
+     * to the caller and the slot already taken is skipped by `drain()`.
+     * @since 1.2
+     **/
+    template <typename... _Params_t>
+    bool post(_Params_t&&... args) {
+        size_t pos = m_tail.load(std::memory_order_relaxed);
+        cell_t *cell;
+
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+
+            if (dif == 0) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (dif < 0) {
+                return false;       /* Full. */
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        pusher_t guard(cell, pos);
+        new (cell->storage) args_t(std::forward<_Params_t>(args)...);
+        guard.valid = true;
+        return true;
+    }
+    /*}}}*/
+    // size_t drain(size_t limit = (size_t)-1);/*{{{*/
+    /**
+     * Delivers the pending notifications.
+     * Must be called by the consumer thread only. For each notification the
+     * target event is triggered with the queued arguments.
+     * @param limit Maximum number of notifications to deliver in this call.
+     * The default is to deliver all notifications pending.
+     * @return The number of notifications delivered. Zero when called from
+     * a delegate run by an outer `drain()`.
+     * @remarks Notifications posted while this function runs can also be
+     * delivered in the same call, up to \a limit.
+     * @since 1.2
+     **/
+    size_t drain(size_t limit = (size_t)-1) {
+        if (m_draining) return 0;
+
+        drainer_t scope(m_draining);
+        size_t count = 0;
+        cell_t *cell;
+
+        while ((count < limit) && ((cell = front()) != NULL)) {
+            popper_t guard(this, cell);
+            if (!cell->valid) continue;
+            dispatch(*cell->args(), typename sstl::MakeIndexesT<sizeof...(_Args_t)>::type());
+            ++count;
+        }
+        return count;
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** Type of the queued arguments. */
+    typedef std::tuple<typename std::decay<_Args_t>::type...> args_t;
+
+    /** A slot of the ring buffer. */
+    struct cell_t {
+        std::atomic<size_t> sequence;   /**< Slot state.            */
+        bool valid;                     /**< Arguments constructed. */
+        alignas(args_t) unsigned char storage[sizeof(args_t)];
+
+        /** Retrieves the arguments stored in the slot. */
+        args_t* args() { return reinterpret_cast<args_t *>(storage); }
+    };
+
+    /** Publishes a taken cell even if copying the arguments throws. */
+    struct pusher_t {
+        cell_t *cell;
+        size_t pos;
+        bool valid;
+
+        pusher_t(cell_t *c, size_t p) : cell(c), pos(p), valid(false) { }
+        ~pusher_t() {
+            cell->valid = valid;
+            cell->sequence.store(pos + 1, std::memory_order_release);
+        }
+    };
+
+    /** Marks the queue as being drained. */
+    struct drainer_t {
+        bool &flag;
+
+        drainer_t(bool &f) : flag(f) { flag = true; }
+        ~drainer_t() { flag = false; }
+    };
+
+    /** Releases the front cell even if a delegate throws. */
+    struct popper_t {
+        EventQueueT *owner;
+        cell_t *cell;
+
+        popper_t(EventQueueT *q, cell_t *c) : owner(q), cell(c) { }
+        ~popper_t() { owner->pop(cell); }
+    };
+
+    /** @name Implementation */ //@{
+    // cell_t* front();/*{{{*/
+    /**
+     * Retrieves the cell at the head of the queue.
+     * @return The cell or \b NULL when the queue is empty.
+     * @since 1.2
+     **/
+    cell_t* front() {
+        size_t pos = m_head.load(std::memory_order_relaxed);
+        cell_t *cell = &m_cells[pos & m_mask];
+        if (cell->sequence.load(std::memory_order_acquire) != (pos + 1))
+            return NULL;
+        return cell;
+    }
+    /*}}}*/
+    // void pop(cell_t *cell);/*{{{*/
+    /**
+     * Destroys the arguments at the head cell and gives it back to the
+     * producers.
+     * @since 1.2
+     **/
+    void pop(cell_t *cell) {
+        size_t pos = m_head.load(std::memory_order_relaxed);
+        if (cell->valid) cell->args()->~args_t();
+        m_head.store(pos + 1, std::memory_order_relaxed);
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+    }
+    /*}}}*/
+    // void dispatch(args_t &args, sstl::IndexesT<_Index...>);/*{{{*/
+    /**
+     * Triggers the target event expanding the queued arguments.
+     * @since 1.2
+     **/
+    template <size_t... _Index>
+    void dispatch(args_t &args, sstl::IndexesT<_Index...>) {
+        m_target->trigger(std::get<_Index>(args)...);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Disabled Operations */ //@{
+    EventQueueT(const EventQueueT &) = delete;
+    EventQueueT& operator =(const EventQueueT &) = delete;
+    //@}
+
+    // Data Members
+    event_t *m_target;                  /**< Event that delivers.         */
+    cell_t *m_cells;                    /**< Ring buffer.                 */
+    size_t m_mask;                      /**< Capacity minus one.          */
+    bool m_draining;                    /**< A drain() is running.        */
+    char m_pad0[64];                    /**< Keeps head and tail apart.   */
+    std::atomic<size_t> m_head;         /**< Next cell to deliver.        */
+    char m_pad1[64];                    /**< Keeps head and tail apart.   */
+    std::atomic<size_t> m_tail;         /**< Next cell to fill.           */
+};
+
+}   /* namespace ss */
+
+#endif /* __SSTLQUEU_HPP_DEFINED__ */
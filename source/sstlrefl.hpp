@@ -0,0 +1,373 @@
+/**
+ * @file
+ * Declares the ss::FieldT and ss::ReflectT class templates.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLREFL_HPP_DEFINED__
+#define __SSTLREFL_HPP_DEFINED__
+
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "sstlfunc.hpp"
+
+namespace sstl {
+
+/**
+ * Extracts the host and value types of getter member functions.
+ * Only `const` member functions are getters: properties are read from
+ * `const` objects. Non `const` member functions have no specialization.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Member_t> struct GetterTraitsT;
+
+template <class _Host_t, typename _Return_t>
+struct GetterTraitsT<_Return_t (_Host_t::*)() const>
+{
+    typedef _Host_t host_type;
+    typedef typename std::decay<_Return_t>::type value_type;
+};
+
+/**
+ * Checks whether all types of a list are the same as the first one.
+ * @since 1.2
+ **/
+template <typename _Type_t, typename... _Types_t>
+struct AllSameT : std::true_type { };
+
+template <typename _Type_t, typename _Head_t, typename... _Tail_t>
+struct AllSameT<_Type_t, _Head_t, _Tail_t...> :
+    std::integral_constant<bool, std::is_same<_Type_t, _Head_t>::value &&
+                                 AllSameT<_Type_t, _Tail_t...>::value> { };
+
+/**
+ * Flat record with one member for each type.
+ * Members are laid out in order in a single object. When all types are
+ * trivially copyable so is the record, and arrays of records are plain
+ * contiguous buffers that can be copied with `memcpy()`.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename... _Values_t> struct RecordT;
+
+template <typename _Head_t>
+struct RecordT<_Head_t>
+{
+    _Head_t head;                   /**< The value. */
+};
+
+template <typename _Head_t, typename... _Tail_t>
+struct RecordT<_Head_t, _Tail_t...>
+{
+    _Head_t head;                   /**< First value.       */
+    RecordT<_Tail_t...> tail;       /**< Remaining values.  */
+};
+
+/**
+ * Accesses a member of a `RecordT` by index.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <size_t _Index>
+struct RecordGetT
+{
+    template <class _Record_t>
+    static auto get(_Record_t &record) -> decltype(RecordGetT<_Index - 1>::get(record.tail)) {
+        return RecordGetT<_Index - 1>::get(record.tail);
+    }
+};
+
+template <>
+struct RecordGetT<0>
+{
+    template <class _Record_t>
+    static auto get(_Record_t &record) -> decltype((record.head)) {
+        return record.head;
+    }
+};
+
+}   /* namespace sstl */
+
+namespace ss {
+/**
+ * Compile time description of a property.
+ * Holds the property name. The getter and setter are template arguments so
+ * calls through this type are direct and can be inlined. Usually built with
+ * the `ssfield()` macro.
+ * @tparam _Get_t Type of the getter member function. Must be a `const`
+ * member function.
+ * @tparam _Getter The getter member function.
+ * @tparam _Set_t Type of the setter member function.
+ * @tparam _Setter The setter member function.
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <typename _Get_t, _Get_t _Getter, typename _Set_t, _Set_t _Setter>
+struct FieldT
+{
+    /** Type of the class owning the property. */
+    typedef typename sstl::GetterTraitsT<_Get_t>::host_type host_type;
+    /** Type of the property value. */
+    typedef typename sstl::GetterTraitsT<_Get_t>::value_type value_type;
+
+    const char *name;               /**< Name of the property. */
+
+    // FieldT(const char *n);/*{{{*/
+    /**
+     * Builds the description.
+     * @param n Name of the property.
+     * @since 1.2
+     **/
+    constexpr explicit FieldT(const char *n) : name(n) { }
+    /*}}}*/
+
+    // static value_type get(const host_type &host);/*{{{*/
+    /**
+     * Calls the getter.
+     * @since 1.2
+     **/
+    static value_type get(const host_type &host) {
+        return (host.*_Getter)();
+    }
+    /*}}}*/
+    // static void set(host_type &host, const value_type &value);/*{{{*/
+    /**
+     * Calls the setter.
+     * @since 1.2
+     **/
+    static void set(host_type &host, const value_type &value) {
+        (host.*_Setter)(value);
+    }
+    /*}}}*/
+};
+
+/**
+ * Table of the properties of a class.
+ * A constant object listing the properties of a host class, built with
+ * `ss::reflect()`. It allows enumerating the properties and copying all of
+ * them at once to and from a `record_t`, a flat structure with one member
+ * for each property. When all property values are trivially copyable the
+ * records are POD and arrays of them are contiguous buffers.
+ *
+ * Getters and setters are called directly, without the function pointers
+ * used by the property objects, and without any name lookup.
+ * @tparam _Fields_t The `ss::FieldT` types describing the properties.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * class Point {
+ * public:
+ *     ss::PropertyT<int> x, y;
+ *
+ *     Point() {
+ *         ssplink(x, this, Point, getX, setX);
+ *         ssplink(y, this, Point, getY, setY);
+ *     }
+ *     ...
+ * };
+ *
+ * constexpr auto PointFields = ss::reflect(ssfield(x, Point, getX, setX),
+ *                                          ssfield(y, Point, getY, setY));
+ * typedef decltype(PointFields)::record_t PointRecord;
+ *
+ * std::vector<PointRecord> buffer(points.size());
+ * PointFields.snapshot(points.data(), points.size(), buffer.data());
+ * ...
+ * PointFields.restore(points.data(), points.size(), buffer.data());
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @since 1.2
+ * @ingroup sstl_properties
+ *//* --------------------------------------------------------------------- */
+template <class... _Fields_t>
+class ReflectT
+{
+    static_assert(sizeof...(_Fields_t) > 0, "At least one field is required");
+
+    typedef std::tuple<_Fields_t...> fields_t;
+    typedef typename sstl::MakeIndexesT<sizeof...(_Fields_t)>::type indexes_t;
+
+    template <size_t _Index>
+    using field_at = typename std::tuple_element<_Index, fields_t>::type;
+
+public:
+    /** Type of the class owning the properties. */
+    typedef typename field_at<0>::host_type host_type;
+    static_assert(sstl::AllSameT<host_type, typename _Fields_t::host_type...>::value,
+                  "All fields must belong to the same host class");
+    /** Flat record with the values of all properties, in order. */
+    typedef sstl::RecordT<typename _Fields_t::value_type...> record_t;
+
+    /** Whether records are trivially copyable. */
+    static const bool trivial = std::is_trivially_copyable<record_t>::value;
+
+    /** @name Constructor */ //@{
+    // ReflectT(const _Fields_t&... fields);/*{{{*/
+    /**
+     * Builds the table.
+     * @param fields The descriptions of the properties.
+     * @since 1.2
+     **/
+    constexpr explicit ReflectT(const _Fields_t&... fields) : m_names{ fields.name... } { }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // size_t size() const;/*{{{*/
+    /**
+     * Number of properties.
+     * @since 1.2
+     **/
+    constexpr size_t size() const { return sizeof...(_Fields_t); }
+    /*}}}*/
+    // const char* name(size_t index) const;/*{{{*/
+    /**
+     * Name of a property.
+     * @param index Position of the property in the table.
+     * @since 1.2
+     **/
+    constexpr const char* name(size_t index) const { return m_names[index]; }
+    /*}}}*/
+    // size_t find(const char *name) const;/*{{{*/
+    /**
+     * Finds a property by name.
+     * @return The position of the property or `size()` when not found.
+     * @since 1.2
+     **/
+    size_t find(const char *name) const {
+        size_t i = 0;
+        while ((i < size()) && (strcmp(m_names[i], name) != 0)) ++i;
+        return i;
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void snapshot(const host_type &host, record_t &record) const;/*{{{*/
+    /**
+     * Copies the values of all properties of an object to a record.
+     * @since 1.2
+     **/
+    void snapshot(const host_type &host, record_t &record) const {
+        read(host, record, indexes_t());
+    }
+    /*}}}*/
+    // void snapshot(const host_type *hosts, size_t count, record_t *records) const;/*{{{*/
+    /**
+     * Copies the values of all properties of several objects.
+     * @param hosts Array of objects.
+     * @param count Number of objects.
+     * @param records Array of \a count records receiving the values.
+     * @since 1.2
+     **/
+    void snapshot(const host_type *hosts, size_t count, record_t *records) const {
+        for (size_t i = 0; i < count; ++i)
+            read(hosts[i], records[i], indexes_t());
+    }
+    /*}}}*/
+    // void restore(host_type &host, const record_t &record) const;/*{{{*/
+    /**
+     * Sets all properties of an object from a record.
+     * Setters are called in the order of the table.
+     * @since 1.2
+     **/
+    void restore(host_type &host, const record_t &record) const {
+        write(host, record, indexes_t());
+    }
+    /*}}}*/
+    // void restore(host_type *hosts, size_t count, const record_t *records) const;/*{{{*/
+    /**
+     * Sets all properties of several objects.
+     * @param hosts Array of objects.
+     * @param count Number of objects.
+     * @param records Array of \a count records with the values.
+     * @since 1.2
+     **/
+    void restore(host_type *hosts, size_t count, const record_t *records) const {
+        for (size_t i = 0; i < count; ++i)
+            write(hosts[i], records[i], indexes_t());
+    }
+    /*}}}*/
+    // void visit(const host_type &host, _Visitor_t &&visitor) const;/*{{{*/
+    /**
+     * Enumerates the properties of an object.
+     * @param host The object.
+     * @param visitor Callable object called as `visitor(name, value)` for
+     * each property, in order. Must accept the value types of all
+     * properties.
+     * @since 1.2
+     **/
+    template <typename _Visitor_t>
+    void visit(const host_type &host, _Visitor_t &&visitor) const {
+        each(host, visitor, indexes_t());
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** @name Implementation */ //@{
+    template <size_t... _Index>
+    static void read(const host_type &host, record_t &record, sstl::IndexesT<_Index...>) {
+        int expand[] = { (sstl::RecordGetT<_Index>::get(record) = field_at<_Index>::get(host), 0)... };
+        (void)expand;
+    }
+
+    template <size_t... _Index>
+    static void write(host_type &host, const record_t &record, sstl::IndexesT<_Index...>) {
+        int expand[] = { (field_at<_Index>::set(host, sstl::RecordGetT<_Index>::get(record)), 0)... };
+        (void)expand;
+    }
+
+    template <typename _Visitor_t, size_t... _Index>
+    void each(const host_type &host, _Visitor_t &visitor, sstl::IndexesT<_Index...>) const {
+        int expand[] = { (visitor(m_names[_Index], field_at<_Index>::get(host)), 0)... };
+        (void)expand;
+    }
+    //@}
+
+    // Data Members
+    const char *m_names[sizeof...(_Fields_t)];  /**< Property names. */
+};
+
+// ReflectT<_Fields_t...> reflect(const _Fields_t&... fields);/*{{{*/
+/**
+ * Builds a property table.
+ * @param fields The descriptions of the properties, usually built with
+ * `ssfield()`. All must belong to the same host class.
+ * @return The `ss::ReflectT` object. Can be stored in a `constexpr`
+ * variable.
+ * @since 1.2
+ * @ingroup sstl_properties
+ **/
+template <class... _Fields_t>
+constexpr ReflectT<_Fields_t...> reflect(const _Fields_t&... fields) {
+    return ReflectT<_Fields_t...>(fields...);
+}
+/*}}}*/
+
+}   /* namespace ss */
+
+// #define ssfield(_Property_, _Type_, _Getter_, _Setter_)/*{{{*/
+/**
+ * Builds a `ss::FieldT` description of a property.
+ * Takes the same names given to `ssplink()`, so both can be written side by
+ * side.
+ * @param _Property_ The property name. Just the name, it becomes a string.
+ * @param _Type_ Type of the class defining the getter and setter.
+ * @param _Getter_ Name of the getter member function. Just the name.
+ * @param _Setter_ Name of the setter member function. Just the name.
+ * @remarks Getters and setters can't be overloaded functions.
+ * @since 1.2
+ **/
+#define ssfield(_Property_, _Type_, _Getter_, _Setter_) \
+    ss::FieldT<decltype(&_Type_::_Getter_), &_Type_::_Getter_, \
+               decltype(&_Type_::_Setter_), &_Type_::_Setter_>(#_Property_)
+/*}}}*/
+
+#endif /* __SSTLREFL_HPP_DEFINED__ */
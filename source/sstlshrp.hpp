@@ -11,8 +11,401 @@
 #ifndef __SSTLSHRP_HPP_DEFINED__
 #define __SSTLSHRP_HPP_DEFINED__
 
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <new>
+#include <utility>
+#include "sstlinst.hpp"
+
+// #define SSTL_SHARED_POOL_LIMIT/*{{{*/
+/**
+ * Maximum number of free control blocks each thread keeps for reuse.
+ * Control blocks of `ss::SharedT` objects are recycled through a thread
+ * local free list. Blocks released when the list is full go back to the
+ * global allocator. Define this macro before including this file to change
+ * the default value.
+ * @since 1.2
+ * @ingroup sstl_shared
+ **/
+#ifndef SSTL_SHARED_POOL_LIMIT
+#define SSTL_SHARED_POOL_LIMIT          256
+#endif
+/*}}}*/
+
+namespace sstl {
+
+/**
+ * Thread local free list of memory blocks with the same size.
+ * Each block is a separate allocation of the global allocator, so a block
+ * can be allocated in one thread and released in another one.
+ * @tparam _Size Size of the blocks, in bytes.
+ * @since 1.2
+ * @ingroup sstl_shared
+ *//* --------------------------------------------------------------------- */
+template <size_t _Size>
+class BlockPoolT
+{
+public:
+    // static void* allocate();/*{{{*/
+    /**
+     * Retrieves a block from the free list of the calling thread.
+     * @return The block. When the list is empty a new block is allocated.
+     * @since 1.2
+     **/
+    static void* allocate() {
+        list_t &list = local();
+        if (!list.head) return ::operator new(block_size);
+
+        node_t *node = list.head;
+        list.head = node->next;
+        --list.count;
+        return node;
+    }
+    /*}}}*/
+    // static void release(void *block);/*{{{*/
+    /**
+     * Gives a block back to the free list of the calling thread.
+     * @param block The block. When the list is full it is deleted.
+     * @since 1.2
+     **/
+    static void release(void *block) {
+        list_t &list = local();
+        if (list.count >= SSTL_SHARED_POOL_LIMIT) {
+            ::operator delete(block);
+            return;
+        }
+
+        node_t *node = static_cast<node_t *>(block);
+        node->next = list.head;
+        list.head  = node;
+        ++list.count;
+    }
+    /*}}}*/
+
+private:
+    /** A free block. */
+    struct node_t { node_t *next; };
+
+    /** Size of each block. Large enough to be a node. */
+    static const size_t block_size = (_Size < sizeof(node_t) ? sizeof(node_t) : _Size);
+
+    /** The free list of a thread. */
+    struct list_t {
+        node_t *head;
+        size_t count;
+
+        list_t() : head(NULL), count(0) { }
+        ~list_t() {
+            while (head) {
+                node_t *node = head;
+                head = node->next;
+                ::operator delete(node);
+            }
+            count = SSTL_SHARED_POOL_LIMIT;     /* Closed. */
+        }
+    };
+
+    /** Retrieves the free list of the calling thread. */
+    static list_t& local() {
+        static thread_local list_t list;
+        return list;
+    }
+};
+
+}   /* namespace sstl */
+
 namespace ss {
 
+/**
+ * Arena for control blocks of `ss::SharedT` objects.
+ * An arena is a fixed memory region where control blocks are taken
+ * sequentially. Releasing a block doesn't give back its memory. All memory
+ * is reclaimed at once by `reset()`. This is useful for lots of short lived
+ * shared pointers created during a single operation, like the handling of
+ * a request.
+ *
+ * The arena is used by the shared pointers built in the calling thread
+ * while a `SharedArena::Scope` object exists. When the arena is full the
+ * blocks are taken from the thread local free list, as usual.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * ss::SharedArena arena(64 * 1024);
+ *
+ * void handleRequest(Request *request) {
+ *     {
+ *         ss::SharedArena::Scope scope(arena);
+ *         ss::SharedT<Item> item(new Item(request));
+ *         process(item);
+ *     }
+ *     arena.reset();
+ * }
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @warning `reset()` must only be called when all shared pointers created
+ * in the arena, and all `ss::WeakT` references taken from them, were
+ * released. The arena must be kept alive until then. A weak reference
+ * reads the control block in `lock()` and `expired()`, so one that
+ * outlives the reset or the arena touches reused or freed memory.
+ * `ss::makeShared()` doesn't use the arena.
+ * @since 1.2
+ * @ingroup sstl_shared
+ *//* --------------------------------------------------------------------- */
+class SharedArena
+{
+public:
+    /**
+     * Selects an arena for the calling thread.
+     * Scopes can be nested. The previous arena is restored when the scope
+     * ends.
+     * @since 1.2
+     **/
+    class Scope
+    {
+    public:
+        /** Uses \a arena until this object is destroyed. */
+        explicit Scope(SharedArena &arena) : m_previous(current()) {
+            current() = &arena;
+        }
+        /** Restores the previous arena. */
+        ~Scope() {
+            current() = m_previous;
+        }
+
+    private:
+        Scope(const Scope &) = delete;
+        Scope& operator =(const Scope &) = delete;
+
+        SharedArena *m_previous;        /**< Arena replaced by this scope. */
+    };
+
+    /** @name Constructors & Destructor */ //@{
+    // explicit SharedArena(size_t capacity);/*{{{*/
+    /**
+     * Builds an arena allocating its memory.
+     * @param capacity Size of the arena, in bytes.
+     * @since 1.2
+     **/
+    explicit SharedArena(size_t capacity) :
+        m_buffer(static_cast<unsigned char *>(::operator new(capacity))),
+        m_capacity(capacity), m_used(0), m_owner(true) { }
+    /*}}}*/
+    // SharedArena(void *buffer, size_t capacity);/*{{{*/
+    /**
+     * Builds an arena over a memory region supplied by the caller.
+     * @param buffer The memory region. Must remain valid while the arena is
+     * in use. It is not released by the arena.
+     * @param capacity Size of the region, in bytes.
+     * @since 1.2
+     **/
+    SharedArena(void *buffer, size_t capacity) :
+        m_buffer(static_cast<unsigned char *>(buffer)),
+        m_capacity(capacity), m_used(0), m_owner(false) { }
+    /*}}}*/
+    // ~SharedArena();/*{{{*/
+    /**
+     * Destructor.
+     * @since 1.2
+     **/
+    ~SharedArena() {
+        if (m_owner) ::operator delete(m_buffer);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // size_t capacity() const;/*{{{*/
+    /**
+     * Retrieves the size of the arena, in bytes.
+     * @since 1.2
+     **/
+    size_t capacity() const { return m_capacity; }
+    /*}}}*/
+    // size_t used() const;/*{{{*/
+    /**
+     * Retrieves the number of bytes taken since the last reset.
+     * @since 1.2
+     **/
+    size_t used() const { return m_used; }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void* allocate(size_t size, size_t align);/*{{{*/
+    /**
+     * Takes a block from the arena.
+     * @param size Size of the block.
+     * @param align Alignment of the block. Must be a power of two.
+     * @return The block or \b NULL when the arena is full.
+     * @since 1.2
+     **/
+    void* allocate(size_t size, size_t align) {
+        uintptr_t base  = reinterpret_cast<uintptr_t>(m_buffer);
+        uintptr_t start = (base + m_used + align - 1) & ~(uintptr_t)(align - 1);
+        if ((start + size) > (base + m_capacity)) return NULL;
+
+        m_used = (size_t)(start + size - base);
+        return reinterpret_cast<void *>(start);
+    }
+    /*}}}*/
+    // void reset();/*{{{*/
+    /**
+     * Reclaims all the memory of the arena.
+     * @warning All shared pointers created in this arena, and the weak
+     * references to them, must have been released.
+     * @since 1.2
+     **/
+    void reset() { m_used = 0; }
+    /*}}}*/
+    //@}
+
+    // Static Functions
+    // static SharedArena*& current();/*{{{*/
+    /**
+     * Arena in use by the calling thread.
+     * @return A reference to the pointer of the arena in use. It is \b NULL
+     * when there is no `Scope` active.
+     * @since 1.2
+     **/
+    static SharedArena*& current() {
+        static thread_local SharedArena *arena = NULL;
+        return arena;
+    }
+    /*}}}*/
+
+private:
+    /** @name Disabled Operations */ //@{
+    SharedArena(const SharedArena &) = delete;
+    SharedArena& operator =(const SharedArena &) = delete;
+    //@}
+
+    // Data Members
+    unsigned char *m_buffer;            /**< Memory region.             */
+    size_t m_capacity;                  /**< Size of the region.        */
+    size_t m_used;                      /**< Bytes taken.               */
+    bool m_owner;                       /**< The region was allocated.  */
+};
+
+/**
+ * Threading policy for reference counters shared between threads.
+ * The counter is a `std::atomic`. Increments are relaxed. Decrements use
+ * acquire/release semantics, so changes made to the object by any thread are
+ * visible to the thread that deletes it. This is the default policy of
+ * `ss::SharedT`.
+ * @since 1.2
+ * @ingroup sstl_shared
+ *//* --------------------------------------------------------------------- */
+struct MultiThread
+{
+    /** Type of the counter. */
+    typedef std::atomic<intptr_t> counter_t;
+
+    // static intptr_t increment(counter_t &counter);/*{{{*/
+    /**
+     * Increments a counter.
+     * @return The value of the counter after the increment.
+     * @since 1.2
+     **/
+    static intptr_t increment(counter_t &counter) {
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+    /*}}}*/
+    // static intptr_t decrement(counter_t &counter);/*{{{*/
+    /**
+     * Decrements a counter.
+     * @return The value of the counter after the decrement.
+     * @since 1.2
+     **/
+    static intptr_t decrement(counter_t &counter) {
+        return counter.fetch_sub(1, std::memory_order_acq_rel) - 1;
+    }
+    /*}}}*/
+    // static intptr_t value(const counter_t &counter);/*{{{*/
+    /**
+     * Reads the value of a counter.
+     * @since 1.2
+     **/
+    static intptr_t value(const counter_t &counter) {
+        return counter.load(std::memory_order_relaxed);
+    }
+    /*}}}*/
+    // static bool incrementIfNotZero(counter_t &counter);/*{{{*/
+    /**
+     * Increments a counter unless it is zero.
+     * This operation is lock free.
+     * @return \b true when the counter was incremented.
+     * @since 1.2
+     **/
+    static bool incrementIfNotZero(counter_t &counter) {
+        intptr_t current = counter.load(std::memory_order_relaxed);
+        while (current != 0) {
+            if (counter.compare_exchange_weak(current, current + 1,
+                    std::memory_order_acq_rel, std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+    /*}}}*/
+};
+
+/**
+ * Threading policy for reference counters used by a single thread.
+ * The counter is a plain integer. Use it with objects that never cross
+ * thread boundaries, like `ss::SharedT<MyClass, ss::SingleThread>`, to avoid
+ * the cost of atomic instructions.
+ * @since 1.2
+ * @ingroup sstl_shared
+ *//* --------------------------------------------------------------------- */
+struct SingleThread
+{
+    /** Type of the counter. */
+    typedef intptr_t counter_t;
+
+    // static intptr_t increment(counter_t &counter);/*{{{*/
+    /**
+     * Increments a counter.
+     * @return The value of the counter after the increment.
+     * @since 1.2
+     **/
+    static intptr_t increment(counter_t &counter) {
+        return ++counter;
+    }
+    /*}}}*/
+    // static intptr_t decrement(counter_t &counter);/*{{{*/
+    /**
+     * Decrements a counter.
+     * @return The value of the counter after the decrement.
+     * @since 1.2
+     **/
+    static intptr_t decrement(counter_t &counter) {
+        return --counter;
+    }
+    /*}}}*/
+    // static intptr_t value(const counter_t &counter);/*{{{*/
+    /**
+     * Reads the value of a counter.
+     * @since 1.2
+     **/
+    static intptr_t value(const counter_t &counter) {
+        return counter;
+    }
+    /*}}}*/
+    // static bool incrementIfNotZero(counter_t &counter);/*{{{*/
+    /**
+     * Increments a counter unless it is zero.
+     * @return \b true when the counter was incremented.
+     * @since 1.2
+     **/
+    static bool incrementIfNotZero(counter_t &counter) {
+        if (counter == 0) return false;
+        ++counter;
+        return true;
+    }
+    /*}}}*/
+};
+
+template <class _Class_t, class _Policy_t = MultiThread> class WeakT;
+template <class _Class_t> class AtomicSharedT;
+
 /**
  * Shared pointer template implementation.
  * Provides a shared pointer with a reference counting mechanism. A shared
@@ -20,6 +413,10 @@ namespace ss {
  * can share the same pointer instance safelly. The pointer is guarded until
  * the last reference is released. Then, the pointer is deleted from memory.
  * @tparam _Class_t The pointer type.
+ * @tparam _Policy_t The threading policy of the reference counter. The
+ * default, `ss::MultiThread`, allows copies of the same pointer to be made
+ * and released in different threads. `ss::SingleThread` uses a plain integer
+ * counter.
  * @par Example:
  ~~~~~~~~~~~~~~~~~~~~~{.cpp}
  * class MyClass {
@@ -43,15 +440,21 @@ namespace ss {
  *
  * // When all pointers goes out of scope, the MyClass instance will be deleted.
  ~~~~~~~~~~~~~~~~~~~~~
+ * Objects can also be built with `ss::makeShared()`. It does a single
+ * allocation holding the object and its reference counter:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * ss::SharedT<MyClass> pointerD = ss::makeShared<MyClass>();
+ ~~~~~~~~~~~~~~~~~~~~~
  * @since 1.0
  * @ingroup sstl_shared
  *//* --------------------------------------------------------------------- */
-template <class _Class_t>
+template <class _Class_t, class _Policy_t = MultiThread>
 class SharedT
 {
 public:
     // Data Types
     typedef _Class_t class_t;           /**< Typedef of the class type.     */
+    typedef _Policy_t policy_t;         /**< Typedef of the thread policy.  */
     typedef void (*release_t)(class_t *data);   /**< Release function type. */
     // struct pointer_t;/*{{{*/
     /**
@@ -59,9 +462,14 @@ public:
      * @since 1.0
      **/
     struct pointer_t {
-        volatile intptr_t refs;             /**< Reference count.   */
+        /** Type of the function that deletes this structure. */
+        typedef void (*free_t)(pointer_t *block);
+
+        typename policy_t::counter_t refs;  /**< Reference count.   */
+        typename policy_t::counter_t weak;  /**< Weak references, plus one while refs > 0. */
         class_t *data;                      /**< Shared pointer.    */
         release_t deleteFun;                /**< Deleter function.  */
+        free_t freeFun;                     /**< Frees this block.  */
 
         // pointer_t(class_t *ptr);/*{{{*/
         /**
@@ -69,8 +477,9 @@ public:
          * @param ptr Pointer to bound to this object.
          * @since 1.0
          **/
-        pointer_t(class_t *ptr) : refs(1), data(ptr),
-            deleteFun(&pointer_t::release)      /* Use default. */
+        pointer_t(class_t *ptr) : refs(1), weak(1), data(ptr),
+            deleteFun(&pointer_t::release),     /* Use default. */
+            freeFun(&pointer_t::free)
         { }
         /*}}}*/
         // pointer_t(class_t *ptr, release_t funPtr);/*{{{*/
@@ -82,19 +491,39 @@ public:
          * @since 1.0
          **/
         pointer_t(class_t *ptr, release_t funPtr) :
-            refs(1), data(ptr), deleteFun(funPtr)
+            refs(1), weak(1), data(ptr), deleteFun(funPtr), freeFun(&pointer_t::free)
         {
             if (!funPtr) deleteFun = &pointer_t::release;
         }
         /*}}}*/
-        // ~pointer_t();/*{{{*/
+        // intptr_t removeShare();/*{{{*/
         /**
-         * Destructor.
-         * Deletes the bounded pointer.
-         * @since 1.0
+         * Decrements the reference count.
+         * When it reaches zero the bound pointer is released with
+         * `deleteFun` and the reference held on the weak count is removed.
+         * @return The number of references after the decrement.
+         * @since 1.2
+         **/
+        intptr_t removeShare() {
+            intptr_t result = policy_t::decrement(refs);
+            if (result <= 0) {
+#ifdef SSTL_INSTRUMENT
+                if (data) sstl::SharedStatsT<_Class_t>::stats().destroyed();
+#endif
+                (*deleteFun)(data);
+                removeWeak();
+            }
+            return result;
+        }
+        /*}}}*/
+        // void removeWeak();/*{{{*/
+        /**
+         * Decrements the weak count.
+         * When it reaches zero this block is released with `freeFun`.
+         * @since 1.2
          **/
-        ~pointer_t() {
-            (*deleteFun)(data);
+        void removeWeak() {
+            if (policy_t::decrement(weak) <= 0) (*freeFun)(this);
         }
         /*}}}*/
 
@@ -109,6 +538,107 @@ public:
             delete pointer;
         }
         /*}}}*/
+        // static void free(pointer_t *block);/*{{{*/
+        /**
+         * Default function to delete a block allocated with `new`.
+         * @param block The block to delete.
+         * @since 1.2
+         **/
+        static void free(pointer_t *block) {
+            delete block;
+        }
+        /*}}}*/
+        // static void recycle(pointer_t *block);/*{{{*/
+        /**
+         * Gives a block back to the thread local free list.
+         * @param block The block to release.
+         * @since 1.2
+         **/
+        static void recycle(pointer_t *block) {
+            block->~pointer_t();
+            sstl::BlockPoolT<sizeof(pointer_t)>::release(block);
+        }
+        /*}}}*/
+        // static void abandon(pointer_t *block);/*{{{*/
+        /**
+         * Destroys a block taken from an arena.
+         * The memory is reclaimed by `ss::SharedArena::reset()`.
+         * @param block The block to release.
+         * @since 1.2
+         **/
+        static void abandon(pointer_t *block) {
+            block->~pointer_t();
+        }
+        /*}}}*/
+
+        // static pointer_t* create(class_t *ptr, release_t funPtr);/*{{{*/
+        /**
+         * Builds a block.
+         * The memory is taken from the arena of the calling thread or, when
+         * there is no arena or it is full, from the thread local free list.
+         * @param ptr The data pointer to hold.
+         * @param funPtr Pointer to the function that will release the data of
+         * the data pointer. Can be \b NULL.
+         * @since 1.2
+         **/
+        static pointer_t* create(class_t *ptr, release_t funPtr) {
+            SharedArena *arena = SharedArena::current();
+            void *memory = (arena ? arena->allocate(sizeof(pointer_t), alignof(pointer_t)) : NULL);
+            free_t freeFun = &pointer_t::abandon;
+
+            if (!memory) {
+                memory  = sstl::BlockPoolT<sizeof(pointer_t)>::allocate();
+                freeFun = &pointer_t::recycle;
+            }
+
+            pointer_t *block = new (memory) pointer_t(ptr, funPtr);
+            block->freeFun = freeFun;
+#ifdef SSTL_INSTRUMENT
+            if (ptr) sstl::SharedStatsT<_Class_t>::stats().created();
+#endif
+            return block;
+        }
+        /*}}}*/
+    };
+    /*}}}*/
+    // struct inplace_t;/*{{{*/
+    /**
+     * Block that holds the object together with its reference counter.
+     * Used by `make()`.
+     * @since 1.2
+     **/
+    struct inplace_t : pointer_t {
+        alignas(class_t) unsigned char storage[sizeof(class_t)];   /**< The object. */
+
+        // inplace_t();/*{{{*/
+        /**
+         * Default constructor.
+         * The object is not built yet.
+         * @since 1.2
+         **/
+        inplace_t() : pointer_t(NULL, &inplace_t::destroy) {
+            this->freeFun = &inplace_t::free;
+        }
+        /*}}}*/
+
+        // static void destroy(class_t *pointer);/*{{{*/
+        /**
+         * Calls the destructor of the object, without releasing its memory.
+         * @since 1.2
+         **/
+        static void destroy(class_t *pointer) {
+            if (pointer) pointer->~class_t();
+        }
+        /*}}}*/
+        // static void free(pointer_t *block);/*{{{*/
+        /**
+         * Deletes the block.
+         * @since 1.2
+         **/
+        static void free(pointer_t *block) {
+            delete static_cast<inplace_t *>(block);
+        }
+        /*}}}*/
     };
     /*}}}*/
 
@@ -120,9 +650,9 @@ public:
      * Builds an empty object. It is bound to anything.
      * @since 1.0
      **/
-    SharedT() : m_pointer(NULL) { }
+    SharedT() : m_data(NULL), m_pointer(NULL) { }
     /*}}}*/
-    // SharedT(const SharedT<class_t> &other);/*{{{*/
+    // SharedT(const SharedT &other);/*{{{*/
     /**
      * Copy constructor.
      * @param other Another template class instance built with the same class
@@ -130,10 +660,36 @@ public:
      * Reference counting will be incremented.
      * @since 1.0
      **/
-    SharedT(const SharedT<class_t> &other) : m_pointer(other.m_pointer) {
+    SharedT(const SharedT &other) : m_data(other.m_data), m_pointer(other.m_pointer) {
         retain();
     }
     /*}}}*/
+    // SharedT(SharedT &&other);/*{{{*/
+    /**
+     * Move constructor.
+     * @param other Another instance. Its pointer is transferred to this
+     * instance and \p other becomes empty. The reference counting doesn't
+     * change.
+     * @since 1.2
+     **/
+    SharedT(SharedT &&other) noexcept : m_data(other.m_data), m_pointer(other.m_pointer) {
+        other.m_data    = NULL;
+        other.m_pointer = NULL;
+    }
+    /*}}}*/
+    // SharedT(const WeakT<_Class_t, _Policy_t> &weak);/*{{{*/
+    /**
+     * Builds a shared pointer from a weak reference.
+     * @param weak The weak reference. When its object was already deleted
+     * this instance is left empty.
+     * @see WeakT::lock()
+     * @since 1.2
+     **/
+    explicit SharedT(const WeakT<_Class_t, _Policy_t> &weak) noexcept :
+        m_data(NULL), m_pointer(NULL) {
+        weak.lock().swap(*this);
+    }
+    /*}}}*/
     // explicit SharedT(class_t *ptr);/*{{{*/
     /**
      * Parametrized constructor.
@@ -143,7 +699,7 @@ public:
      * instances of \c SharedT objects.
      * @since 1.0
      **/
-    explicit SharedT(class_t *ptr) : m_pointer(new pointer_t(ptr)) { }
+    explicit SharedT(class_t *ptr) : m_data(ptr), m_pointer(pointer_t::create(ptr, NULL)) { }
     /*}}}*/
     // SharedT(class_t *ptr, void (*destructor)(_Class_t*));/*{{{*/
     /**
@@ -158,7 +714,7 @@ public:
      * @since 1.0
      **/
     SharedT(class_t *ptr, void (*destructor)(_Class_t*)) :
-        m_pointer(new pointer_t(ptr), destructor) { }
+        m_data(ptr), m_pointer(pointer_t::create(ptr, destructor)) { }
     /*}}}*/
     // ~SharedT();/*{{{*/
     /**
@@ -184,7 +740,7 @@ public:
      * @since 1.0
      **/
     class_t* data() const {
-        return ((m_pointer != NULL) ? m_pointer->data : NULL);
+        return m_data;
     }
     /*}}}*/
     // intptr_t shares() const;/*{{{*/
@@ -196,13 +752,13 @@ public:
      * @since 1.0
      **/
     intptr_t shares() const {
-        return (m_pointer ? m_pointer->refs : 0);
+        return (m_pointer ? policy_t::value(m_pointer->refs) : 0);
     }
     /*}}}*/
     //@}
 
     /** @name Operations */ //@{
-    // SharedT<class_t>& assign(const SharedT<class_t> &other);/*{{{*/
+    // SharedT& assign(const SharedT &other);/*{{{*/
     /**
      * Assignment operation.
      * @param other Another template class instance built with the same class
@@ -211,15 +767,16 @@ public:
      * @return A reference to \b this instance.
      * @since 1.0
      **/
-    SharedT<class_t>& assign(const SharedT<class_t> &other) {
+    SharedT& assign(const SharedT &other) {
         if (m_pointer == other.m_pointer) return *this;     /* Nothing needed. */
         release();
+        m_data    = other.m_data;
         m_pointer = other.m_pointer;
         retain();
         return *this;
     }
     /*}}}*/
-    // SharedT<class_t>& assign(class_t *ptr, void (*destructor)(class_t*));/*{{{*/
+    // SharedT& assign(class_t *ptr, void (*destructor)(class_t*));/*{{{*/
     /**
      * Assignment Operation.
      * @param ptr Pointer to the object to be bound. No reference increment
@@ -231,13 +788,53 @@ public:
      * @return A reference to this instance.
      * @since 1.0
      **/
-    SharedT<class_t>& assign(class_t *ptr, void (*destructor)(class_t*)) {
+    SharedT& assign(class_t *ptr, void (*destructor)(class_t*)) {
         if (ptr == data()) return *this;
         release();
-        m_pointer = new pointer_t(ptr, destructor);
+        m_pointer = pointer_t::create(ptr, destructor);
+        m_data    = ptr;
         return *this;
     }
     /*}}}*/
+    // void swap(SharedT &other);/*{{{*/
+    /**
+     * Exchanges the pointers of two instances.
+     * @param other The other instance. The reference counting doesn't
+     * change.
+     * @since 1.2
+     **/
+    void swap(SharedT &other) noexcept {
+        class_t *data = m_data;
+        pointer_t *pointer = m_pointer;
+        m_data    = other.m_data;
+        m_pointer = other.m_pointer;
+        other.m_data    = data;
+        other.m_pointer = pointer;
+    }
+    /*}}}*/
+    // void reset();/*{{{*/
+    /**
+     * Releases the bound pointer, leaving this instance empty.
+     * @since 1.2
+     **/
+    void reset() noexcept {
+        release();
+    }
+    /*}}}*/
+    // void reset(class_t *ptr, void (*destructor)(class_t*) = NULL);/*{{{*/
+    /**
+     * Releases the bound pointer and binds another one.
+     * @param ptr Pointer to the object to be bound. When \b NULL this
+     * instance is left empty.
+     * @param destructor Custom function to use as destructor of the object
+     * passed through \p ptr parameter. When \b NULL the object is deleted.
+     * @since 1.2
+     **/
+    void reset(class_t *ptr, void (*destructor)(class_t*) = NULL) {
+        if (ptr) assign(ptr, destructor);
+        else     release();
+    }
+    /*}}}*/
     //@}
 
     /** @name Overloaded Operators */ //@{
@@ -288,7 +885,7 @@ public:
         return data();
     }
     /*}}}*/
-    // SharedT<class_t>& operator=(const SharedT<class_t> &other);/*{{{*/
+    // SharedT& operator=(const SharedT &other);/*{{{*/
     /**
      * Assignment operator.
      * @param other Another template class instance built with the same class
@@ -297,11 +894,25 @@ public:
      * @return A reference to \b this instance.
      * @since 1.0
      **/
-    SharedT<class_t>& operator=(const SharedT<class_t> &other) {
+    SharedT& operator=(const SharedT &other) {
         return assign(other);
     }
     /*}}}*/
-    // SharedT<class_t>& operator=(class_t *ptr);/*{{{*/
+    // SharedT& operator=(SharedT &&other);/*{{{*/
+    /**
+     * Move assignment operator.
+     * @param other Another instance. Its pointer is transferred to this
+     * instance and \p other becomes empty. The pointer previously bound to
+     * this instance is released.
+     * @return A reference to \b this instance.
+     * @since 1.2
+     **/
+    SharedT& operator=(SharedT &&other) noexcept {
+        SharedT(std::move(other)).swap(*this);
+        return *this;
+    }
+    /*}}}*/
+    // SharedT& operator=(class_t *ptr);/*{{{*/
     /**
      * Assignment operator overload.
      * @param ptr Pointer to the object to be bound. No reference increment
@@ -313,25 +924,66 @@ public:
      * can use the `assign()` function.
      * @since 1.0
      **/
-    SharedT<class_t>& operator=(class_t *ptr) {
+    SharedT& operator=(class_t *ptr) {
         return assign(ptr, &pointer_t::release);
     }
     /*}}}*/
     //@}
 
+    // Static Functions
+    // static SharedT make(_Args_t&&... args);/*{{{*/
+    /**
+     * Builds an object and a shared pointer to it with a single allocation.
+     * @param args Arguments passed to the constructor of \a _Class_t.
+     * @return A shared pointer to the new object.
+     * @remarks The object and the reference counter are kept in the same
+     * memory block. The deleter function of the block calls the object
+     * destructor. The memory is released with the block. `ss::makeShared()`
+     * is a shorter way to call this function.
+     * @since 1.2
+     **/
+    template <typename... _Args_t>
+    static SharedT make(_Args_t&&... args) {
+        inplace_t *block = new inplace_t();
+        try {
+            block->data = new (block->storage) class_t(std::forward<_Args_t>(args)...);
+        } catch (...) {
+            delete block;
+            throw;
+        }
+#ifdef SSTL_INSTRUMENT
+        sstl::SharedStatsT<_Class_t>::stats().created();
+#endif
+
+        return SharedT(block->data, block);
+    }
+    /*}}}*/
+
 private:
+    friend class WeakT<_Class_t, _Policy_t>;
+    friend class AtomicSharedT<_Class_t>;
+
+    // SharedT(class_t *ptr, pointer_t *block);/*{{{*/
+    /**
+     * Builds an instance taking a reference already counted in \a block.
+     * @since 1.2
+     **/
+    SharedT(class_t *ptr, pointer_t *block) noexcept : m_data(ptr), m_pointer(block) { }
+    /*}}}*/
+
     /** @name Implementation */ //@{
     // intptr_t retain();/*{{{*/
     /**
      * Increment the reference counting of the bound pointer.
      * @returns The number of references after the increment.
-     * @remarks This operation is atomic with allows to be called from
-     * different threads without race conditions.
+     * @remarks This operation is atomic, when using the `ss::MultiThread`
+     * policy, which allows it to be called from different threads without
+     * race conditions.
      * @since 1.0
      **/
-    intptr_t retain() {
+    intptr_t retain() noexcept {
         if (!m_pointer) return 0;
-        return ++m_pointer->refs;
+        return policy_t::increment(m_pointer->refs);
     }
     /*}}}*/
     // intptr_t release();/*{{{*/
@@ -342,11 +994,11 @@ private:
      * deleted from memory.
      * @since 1.0
      **/
-    intptr_t release() {
+    intptr_t release() noexcept {
         if (!m_pointer) return 0;
-        intptr_t result = --m_pointer->refs;
-        if (result <= 0) { delete m_pointer; }
+        intptr_t result = m_pointer->removeShare();
         m_pointer = NULL;
+        m_data    = NULL;
         return result;
     }
     /*}}}*/
@@ -354,9 +1006,274 @@ private:
 
 private:
     // Data Members
-    pointer_t *m_pointer;           /**< The shared pointer holder. */
+    class_t *m_data;                /**< Copy of the shared pointer. */
+    pointer_t *m_pointer;           /**< The shared pointer holder.  */
+};
+
+/**
+ * Weak reference to an object held by `ss::SharedT`.
+ * A weak reference doesn't keep the object alive. It shares the control
+ * block of the shared pointers, so it knows when the object was deleted
+ * without the need of any lookup table. To use the object a shared pointer
+ * must be obtained through `lock()`.
+ * @tparam _Class_t The pointer type.
+ * @tparam _Policy_t The threading policy. Must be the same of the shared
+ * pointers.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * ss::SharedT<MyClass> pointer(new MyClass);
+ * ss::WeakT<MyClass> observer(pointer);
+ *
+ * if (ss::SharedT<MyClass> alive = observer.lock())
+ *     alive->operation();      // The object still exists.
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @remarks The control block is released when the last shared pointer
+ * and the last weak reference are gone. For objects built with
+ * `ss::makeShared()` the memory of the object is kept until then too.
+ * @warning Control blocks taken from an `ss::SharedArena` are not kept by
+ * weak references: their memory goes away with `SharedArena::reset()` or
+ * with the arena. A weak reference to an object created while a
+ * `SharedArena::Scope` was active must be released before that.
+ * @since 1.2
+ * @ingroup sstl_shared
+ *//* --------------------------------------------------------------------- */
+template <class _Class_t, class _Policy_t>
+class WeakT
+{
+public:
+    // Data Types
+    typedef _Class_t class_t;                   /**< The class type.    */
+    typedef _Policy_t policy_t;                 /**< The thread policy. */
+    typedef SharedT<_Class_t, _Policy_t> shared_t;  /**< Shared pointer type. */
+
+    /** @name Constructors & Destructor */ //@{
+    // WeakT();/*{{{*/
+    /**
+     * Default constructor.
+     * Builds an empty weak reference.
+     * @since 1.2
+     **/
+    WeakT() noexcept : m_data(NULL), m_pointer(NULL) { }
+    /*}}}*/
+    // WeakT(const shared_t &shared);/*{{{*/
+    /**
+     * Builds a weak reference to the object of a shared pointer.
+     * @param shared The shared pointer.
+     * @since 1.2
+     **/
+    WeakT(const shared_t &shared) noexcept :
+        m_data(shared.m_data), m_pointer(shared.m_pointer) {
+        retain();
+    }
+    /*}}}*/
+    // WeakT(const WeakT &other);/*{{{*/
+    /**
+     * Copy constructor.
+     * @since 1.2
+     **/
+    WeakT(const WeakT &other) noexcept :
+        m_data(other.m_data), m_pointer(other.m_pointer) {
+        retain();
+    }
+    /*}}}*/
+    // WeakT(WeakT &&other);/*{{{*/
+    /**
+     * Move constructor.
+     * @param other Another instance. It becomes empty.
+     * @since 1.2
+     **/
+    WeakT(WeakT &&other) noexcept :
+        m_data(other.m_data), m_pointer(other.m_pointer) {
+        other.m_data    = NULL;
+        other.m_pointer = NULL;
+    }
+    /*}}}*/
+    // ~WeakT();/*{{{*/
+    /**
+     * Destructor.
+     * @since 1.2
+     **/
+    ~WeakT() {
+        release();
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // bool expired() const;/*{{{*/
+    /**
+     * Checks whether the object was already deleted.
+     * @returns \b true when the object was deleted or this reference is
+     * empty. \b false otherwise.
+     * @remarks In multithread programs the result can change just after
+     * this function returns. Use `lock()` to actually use the object.
+     * @since 1.2
+     **/
+    bool expired() const noexcept {
+        return (shares() == 0);
+    }
+    /*}}}*/
+    // intptr_t shares() const;/*{{{*/
+    /**
+     * Retrieves the number of shared pointers holding the object.
+     * @since 1.2
+     **/
+    intptr_t shares() const noexcept {
+        return (m_pointer ? policy_t::value(m_pointer->refs) : 0);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // shared_t lock() const;/*{{{*/
+    /**
+     * Retrieves a shared pointer to the object.
+     * @return A shared pointer holding the object or an empty shared pointer
+     * when the object was already deleted. This operation doesn't lock.
+     * @since 1.2
+     **/
+    shared_t lock() const noexcept {
+        if (!m_pointer || !policy_t::incrementIfNotZero(m_pointer->refs))
+            return shared_t();
+        return shared_t(m_data, m_pointer);
+    }
+    /*}}}*/
+    // void swap(WeakT &other);/*{{{*/
+    /**
+     * Exchanges the objects referenced by two instances.
+     * @since 1.2
+     **/
+    void swap(WeakT &other) noexcept {
+        class_t *data = m_data;
+        typename shared_t::pointer_t *pointer = m_pointer;
+        m_data    = other.m_data;
+        m_pointer = other.m_pointer;
+        other.m_data    = data;
+        other.m_pointer = pointer;
+    }
+    /*}}}*/
+    // void reset();/*{{{*/
+    /**
+     * Releases the reference, leaving this instance empty.
+     * @since 1.2
+     **/
+    void reset() noexcept {
+        release();
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // WeakT& operator=(const WeakT &other);/*{{{*/
+    /**
+     * Assignment operator.
+     * @return A reference to \b this instance.
+     * @since 1.2
+     **/
+    WeakT& operator=(const WeakT &other) noexcept {
+        WeakT(other).swap(*this);
+        return *this;
+    }
+    /*}}}*/
+    // WeakT& operator=(WeakT &&other);/*{{{*/
+    /**
+     * Move assignment operator.
+     * @return A reference to \b this instance.
+     * @since 1.2
+     **/
+    WeakT& operator=(WeakT &&other) noexcept {
+        WeakT(std::move(other)).swap(*this);
+        return *this;
+    }
+    /*}}}*/
+    // WeakT& operator=(const shared_t &shared);/*{{{*/
+    /**
+     * References the object of a shared pointer.
+     * @return A reference to \b this instance.
+     * @since 1.2
+     **/
+    WeakT& operator=(const shared_t &shared) noexcept {
+        WeakT(shared).swap(*this);
+        return *this;
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** @name Implementation */ //@{
+    // void retain();/*{{{*/
+    /**
+     * Increments the weak counter.
+     * @since 1.2
+     **/
+    void retain() noexcept {
+        if (m_pointer) policy_t::increment(m_pointer->weak);
+    }
+    /*}}}*/
+    // void release();/*{{{*/
+    /**
+     * Decrements the weak counter, leaving this instance empty.
+     * @since 1.2
+     **/
+    void release() noexcept {
+        if (m_pointer) m_pointer->removeWeak();
+        m_pointer = NULL;
+        m_data    = NULL;
+    }
+    /*}}}*/
+    //@}
+
+    // Data Members
+    class_t *m_data;                            /**< The object.        */
+    typename shared_t::pointer_t *m_pointer;    /**< The control block. */
 };
 
+// void swap(WeakT<_Class_t, _Policy_t> &one, WeakT<_Class_t, _Policy_t> &another);/*{{{*/
+/**
+ * Exchanges the objects referenced by two weak references.
+ * @since 1.2
+ * @ingroup sstl_shared
+ **/
+template <class _Class_t, class _Policy_t>
+void swap(WeakT<_Class_t, _Policy_t> &one, WeakT<_Class_t, _Policy_t> &another) noexcept {
+    one.swap(another);
+}
+/*}}}*/
+
+// SharedT<_Class_t> makeShared(_Args_t&&... args);/*{{{*/
+/**
+ * Builds an object and a shared pointer to it with a single allocation.
+ * @tparam _Class_t Type of the object to build.
+ * @tparam _Policy_t Threading policy of the shared pointer.
+ * @param args Arguments passed to the constructor of \a _Class_t.
+ * @return A shared pointer to the new object.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * ss::SharedT<std::string> text = ss::makeShared<std::string>(10, ' ');
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @see ss::SharedT::make()
+ * @since 1.2
+ * @ingroup sstl_shared
+ **/
+template <class _Class_t, class _Policy_t = MultiThread, typename... _Args_t>
+SharedT<_Class_t, _Policy_t> makeShared(_Args_t&&... args) {
+    return SharedT<_Class_t, _Policy_t>::make(std::forward<_Args_t>(args)...);
+}
+/*}}}*/
+// void swap(SharedT<_Class_t, _Policy_t> &one, SharedT<_Class_t, _Policy_t> &another);/*{{{*/
+/**
+ * Exchanges the pointers of two shared pointers.
+ * Found by argument dependent lookup, so generic code calling `swap()`
+ * doesn't change the reference counting.
+ * @since 1.2
+ * @ingroup sstl_shared
+ **/
+template <class _Class_t, class _Policy_t>
+void swap(SharedT<_Class_t, _Policy_t> &one, SharedT<_Class_t, _Policy_t> &another) noexcept {
+    one.swap(another);
+}
+/*}}}*/
+
 }   /* namespace ss */
 
 /**
@@ -366,7 +1283,7 @@ private:
  * @since 1.0
  * @ingroup sstl_shared
  **/
-// bool operator ==(const ss::SharedT<T> &one, const ss::SharedT<U> &another);/*{{{*/
+// bool operator ==(const ss::SharedT<T, P> &one, const ss::SharedT<U, Q> &another);/*{{{*/
 /**
  * Overloaded comparison operator.
  * Compares two instances of ss::SharedT object.
@@ -377,12 +1294,12 @@ private:
  * @since 1.0
  * @ingroup sstl_shared_operators
  **/
-template <class T, class U>
-bool operator ==(const ss::SharedT<T> &one, const ss::SharedT<U> &another) {
+template <class T, class P, class U, class Q>
+bool operator ==(const ss::SharedT<T, P> &one, const ss::SharedT<U, Q> &another) {
     return (one.data() == another.data());
 }
 /*}}}*/
-// bool operator ==(const ss::SharedT<T> &one, int ptr);/*{{{*/
+// bool operator ==(const ss::SharedT<T, P> &one, int ptr);/*{{{*/
 /**
  * Comparison to \b NULL operator.
  * @param one One instance of ss::SharedT object.
@@ -392,12 +1309,12 @@ bool operator ==(const ss::SharedT<T> &one, const ss::SharedT<U> &another) {
  * @since 1.0
  * @ingroup sstl_shared_operators
  **/
-template <class T>
-bool operator ==(const ss::SharedT<T> &one, int ptr) {
+template <class T, class P>
+bool operator ==(const ss::SharedT<T, P> &one, int ptr) {
     return (ptr == (int)one.data());
 }
 /*}}}*/
-// bool operator !=(const ss::SharedT<T> &one, const ss::SharedT<U> &another);/*{{{*/
+// bool operator !=(const ss::SharedT<T, P> &one, const ss::SharedT<U, Q> &another);/*{{{*/
 /**
  * Overloaded inequality operator.
  * Compares two instances of ss::SharedT object.
@@ -408,12 +1325,12 @@ bool operator ==(const ss::SharedT<T> &one, int ptr) {
  * @since 1.0
  * @ingroup sstl_shared_operators
  **/
-template <class T, class U>
-bool operator !=(const ss::SharedT<T> &one, const ss::SharedT<U> &another) {
+template <class T, class P, class U, class Q>
+bool operator !=(const ss::SharedT<T, P> &one, const ss::SharedT<U, Q> &another) {
     return (one.data() != another.data());
 }
 /*}}}*/
-// bool operator !=(const ss::SharedT<T> &one, int ptr);/*{{{*/
+// bool operator !=(const ss::SharedT<T, P> &one, int ptr);/*{{{*/
 /**
  * Comparison to \b NULL operator.
  * @param one One instance of ss::SharedT object.
@@ -423,8 +1340,8 @@ bool operator !=(const ss::SharedT<T> &one, const ss::SharedT<U> &another) {
  * @since 1.0
  * @ingroup sstl_shared_operators
  **/
-template <class T>
-bool operator !=(const ss::SharedT<T> &one, int ptr) {
+template <class T, class P>
+bool operator !=(const ss::SharedT<T, P> &one, int ptr) {
     return (ptr != (int)one.data());
 }
 /*}}}*/
@@ -0,0 +1,289 @@
+/**
+ * @file
+ * Declares the ss::StaticEventT class template.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#ifndef __SSTLSTEV_HPP_DEFINED__
+#define __SSTLSTEV_HPP_DEFINED__
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "sstlfunc.hpp"
+
+namespace sstl {
+
+/**
+ * Extracts the host type of a pointer to member function.
+ * @tparam _Method_t Type of the pointer to member function.
+ * @since 1.2
+ **/
+template <typename _Method_t> struct MemberTraitsT;
+
+/**
+ * Extracts the host type of a pointer to member function.
+ * Specialization for non const member functions.
+ * @since 1.2
+ **/
+template <class _Host_t, typename _Return_t, typename... _Args_t>
+struct MemberTraitsT<_Return_t (_Host_t::*)(_Args_t...)>
+{
+    typedef _Host_t host_t;             /**< Type of the host object. */
+};
+
+/**
+ * Extracts the host type of a pointer to member function.
+ * Specialization for const member functions.
+ * @since 1.2
+ **/
+template <class _Host_t, typename _Return_t, typename... _Args_t>
+struct MemberTraitsT<_Return_t (_Host_t::*)(_Args_t...) const>
+{
+    typedef const _Host_t host_t;       /**< Type of the host object. */
+};
+
+}   /* namespace sstl */
+
+namespace ss {
+
+/**
+ * A member function bound at compile time to an `ss::StaticEventT`.
+ * @tparam _Method_t Type of the pointer to member function.
+ * @tparam _Method The pointer to member function.
+ * @remarks Use the `ssbinding()` macro to avoid writing the type of the
+ * member function. With a C++17 compiler `ss::Binding<&A::f>` can be used.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Method_t, _Method_t _Method>
+struct BindingT
+{
+    /** Type of the host object. */
+    typedef typename sstl::MemberTraitsT<_Method_t>::host_t host_t;
+
+    // static void call(host_t *host, _Params_t&&... args);/*{{{*/
+    /**
+     * Calls the member function.
+     * @param host The host object. Nothing is done when it is \b NULL.
+     * @param args Arguments passed to the member function.
+     * @since 1.2
+     **/
+    template <typename... _Params_t>
+    static void call(host_t *host, _Params_t&&... args) {
+        if (host) (host->*_Method)(std::forward<_Params_t>(args)...);
+    }
+    /*}}}*/
+};
+
+#if (__cplusplus >= 201703L)
+/**
+ * A member function bound at compile time to an `ss::StaticEventT`.
+ * Shorter form of `ss::BindingT`, for C++17 compilers.
+ * @tparam _Method The pointer to member function.
+ * @since 1.2
+ * @ingroup sstl_events
+ **/
+template <auto _Method>
+using Binding = BindingT<decltype(_Method), _Method>;
+#endif
+
+/**
+ * Event with a list of delegates defined at compile time.
+ * Every member function that handles this event is a template parameter,
+ * given through `ss::BindingT`. Only the host objects are given at run
+ * time. So `trigger()` expands, in the order of the template parameters,
+ * to direct calls of the member functions that the compiler can inline.
+ * There is no function pointer and no list to scan.
+ *
+ * The interface follows `ss::EventT`: it is triggered with `trigger()` or
+ * `operator ()`, so an event with fixed wiring can replace an `ss::EventT`
+ * without changing the code that triggers it.
+ * @tparam _Signature_t The signature of the event. Example: `void(int)`.
+ * @tparam _Bindings_t The list of `ss::BindingT` types.
+ * @par Example:
+ ~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * class Renderer { public: void onResize(int w, int h); };
+ * class Layout   { public: void onResize(int w, int h); };
+ *
+ * typedef ss::StaticEventT<void(int, int),
+ *                          ssbinding(Layout, onResize),
+ *                          ssbinding(Renderer, onResize)> ResizeEvent;
+ *
+ * ResizeEvent onResize(&layout, &renderer);
+ * onResize(640, 480);  // layout.onResize(640, 480); renderer.onResize(640, 480);
+ ~~~~~~~~~~~~~~~~~~~~~
+ * @note Requires C++11.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Signature_t, class... _Bindings_t>
+class StaticEventT;
+
+/**
+ * Static event for functions with any number of arguments.
+ * @tparam _Return_t The return type of the function. Should be void.
+ * @tparam _Args_t Types of the function parameters.
+ * @tparam _Bindings_t The list of `ss::BindingT` types. At least one.
+ * @since 1.2
+ * @ingroup sstl_events
+ *//* --------------------------------------------------------------------- */
+template <typename _Return_t, typename... _Args_t, class... _Bindings_t>
+class StaticEventT<_Return_t (_Args_t...), _Bindings_t...>
+{
+    static_assert(sizeof...(_Bindings_t) > 0, "ss::StaticEventT requires at least one binding");
+
+public:
+    /** Type of the host object of the binding at \a _Index. */
+    template <size_t _Index>
+    using host_t = typename std::tuple_element<_Index, std::tuple<_Bindings_t...> >::type::host_t;
+
+    /** @name Constructors & Destructor */ //@{
+    // StaticEventT();/*{{{*/
+    /**
+     * Default constructor.
+     * All hosts are \b NULL. Their bindings are skipped until a host is set
+     * with `bind()`.
+     * @since 1.2
+     **/
+    StaticEventT() : m_hosts() { }
+    /*}}}*/
+    // explicit StaticEventT(typename _Bindings_t::host_t*... hosts);/*{{{*/
+    /**
+     * Builds the event with its host objects.
+     * @param hosts One host object for each binding, in the same order.
+     * Can be \b NULL.
+     * @since 1.2
+     **/
+    explicit StaticEventT(typename _Bindings_t::host_t*... hosts) : m_hosts(hosts...) { }
+    /*}}}*/
+    //@}
+
+    /** @name Attributes */ //@{
+    // static constexpr size_t count();/*{{{*/
+    /**
+     * Retrieves the number of bindings.
+     * @since 1.2
+     **/
+    static constexpr size_t count() { return sizeof...(_Bindings_t); }
+    /*}}}*/
+    // host_t<_Index>* host() const;/*{{{*/
+    /**
+     * Retrieves the host object of a binding.
+     * @tparam _Index Position of the binding.
+     * @since 1.2
+     **/
+    template <size_t _Index>
+    host_t<_Index>* host() const { return std::get<_Index>(m_hosts); }
+    /*}}}*/
+    //@}
+
+    /** @name Operations */ //@{
+    // void bind(host_t<_Index> *host);/*{{{*/
+    /**
+     * Sets the host object of a binding.
+     * @tparam _Index Position of the binding.
+     * @param host The host object. \b NULL disables the binding.
+     * @since 1.2
+     **/
+    template <size_t _Index>
+    void bind(host_t<_Index> *host) { std::get<_Index>(m_hosts) = host; }
+    /*}}}*/
+    // void unbound(const void *target);/*{{{*/
+    /**
+     * Disables all bindings with the specified host object.
+     * @param target The host object.
+     * @since 1.2
+     **/
+    void unbound(const void *target) {
+        unbind(target, typename sstl::MakeIndexesT<sizeof...(_Bindings_t)>::type());
+    }
+    /*}}}*/
+    // void trigger(_Params_t&&... args);/*{{{*/
+    /**
+     * Calls the bound member functions, in order.
+     * @param args Arguments to pass to the functions. As in `ss::EventT`
+     * they are passed by reference to every function and never moved from.
+     * @since 1.2
+     **/
+    template <typename... _Params_t>
+    void trigger(_Params_t&&... args) {
+        dispatch(typename sstl::MakeIndexesT<sizeof...(_Bindings_t)>::type(), args...);
+    }
+    /*}}}*/
+    //@}
+
+    /** @name Overloaded Operators */ //@{
+    // void operator ()(_Params_t&&... args);/*{{{*/
+    /**
+     * Calls the bound member functions.
+     * @since 1.2
+     **/
+    template <typename... _Params_t>
+    void operator ()(_Params_t&&... args) {
+        this->trigger(std::forward<_Params_t>(args)...);
+    }
+    /*}}}*/
+    //@}
+
+private:
+    /** @name Implementation */ //@{
+    // void dispatch(sstl::IndexesT<_Index...>, _Params_t&... args);/*{{{*/
+    /**
+     * Expands the calls of all bindings.
+     * @since 1.2
+     **/
+    template <size_t... _Index, typename... _Params_t>
+    void dispatch(sstl::IndexesT<_Index...>, _Params_t&... args) {
+        /* Initializer lists are evaluated in order. */
+        int expand[] = { 0, (_Bindings_t::call(std::get<_Index>(m_hosts), args...), 0)... };
+        (void)expand;
+    }
+    /*}}}*/
+    // void unbind(const void *target, sstl::IndexesT<_Index...>);/*{{{*/
+    /**
+     * Clears the hosts equal to \a target.
+     * @since 1.2
+     **/
+    template <size_t... _Index>
+    void unbind(const void *target, sstl::IndexesT<_Index...>) {
+        int expand[] = { 0, (clear(std::get<_Index>(m_hosts), target), 0)... };
+        (void)expand;
+    }
+    /*}}}*/
+    // static void clear(_Host_t *&host, const void *target);/*{{{*/
+    /**
+     * Clears a host when it is \a target.
+     * @since 1.2
+     **/
+    template <class _Host_t>
+    static void clear(_Host_t *&host, const void *target) {
+        if ((const void *)host == target) host = NULL;
+    }
+    /*}}}*/
+    //@}
+
+    // Data Members
+    std::tuple<typename _Bindings_t::host_t*...> m_hosts;  /**< Host objects. */
+};
+
+}   /* namespace ss */
+
+// #define ssbinding(_Type_, _Method_)/*{{{*/
+/**
+ * Builds the `ss::BindingT` type of a member function.
+ * @param _Type_ Type of the class defining the member function.
+ * @param _Method_ Name of the member function. Just the name.
+ * @remarks The member function can't be overloaded.
+ * @since 1.2
+ **/
+#define ssbinding(_Type_, _Method_) \
+    ss::BindingT<decltype(&_Type_::_Method_), &_Type_::_Method_>
+/*}}}*/
+
+#endif /* __SSTLSTEV_HPP_DEFINED__ */
@@ -0,0 +1,709 @@
+/**
+ * @file
+ * Regression tests of the library.
+ * Each test prints its name and the result. The program returns non zero
+ * when any check fails. Build and run with `make test`.
+ *
+ * @author Alessandro Antonello
+ * @date   oct 14, 2026
+ * @since  Super Simple Template Library 1.2
+ *
+ * @copyright 2016, Paralaxe Tecnologia Ltda.. All rights reserved.
+ **/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "libsstl.h"
+
+/** Number of live blocks from `operator new`. */
+static std::atomic<long> g_allocations(0);
+/** Number of calls to `operator new`. */
+static std::atomic<long> g_news(0);
+
+void* operator new(size_t size) {
+    void *p = std::malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    ++g_allocations;
+    ++g_news;
+    return p;
+}
+void operator delete(void *p) noexcept {
+    if (!p) return;
+    --g_allocations;
+    std::free(p);
+}
+
+namespace {
+
+/** Number of failed checks. */
+int g_failures = 0;
+
+// #define check(_Condition_)/*{{{*/
+/**
+ * Counts and reports a failed condition.
+ **/
+#define check(_Condition_) \
+    do { if (!(_Condition_)) { \
+        printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #_Condition_); \
+        ++g_failures; \
+    } } while (0)
+/*}}}*/
+
+/* ------------------------------------------------------------------------ */
+/* Functors                                                                 */
+/* ------------------------------------------------------------------------ */
+typedef ss::FunctorT<int(int)> IntFunctor;
+
+static_assert(sizeof(IntFunctor) == 2 * sizeof(void *),
+              "member functors must be two pointers");
+static_assert(!std::is_convertible<int, IntFunctor>::value &&
+              !std::is_convertible<std::string, IntFunctor>::value &&
+              !std::is_convertible<const char *, IntFunctor>::value,
+              "only callables convert to a functor");
+static_assert(!std::is_convertible<void (*)(int), IntFunctor>::value &&
+              !std::is_convertible<int (*)(const char *), IntFunctor>::value &&
+              std::is_convertible<int (*)(int), IntFunctor>::value &&
+              std::is_convertible<long (*)(long), IntFunctor>::value,
+              "callables must match the functor signature");
+
+/** Free function bound in the functor tests. */
+int twice(int value) { return value * 2; }
+
+/** Host object of the functor tests. */
+struct Adder {
+    int base;
+    int add(int value) { return base + value; }
+};
+
+// void testFunctorBinding();/*{{{*/
+/**
+ * Functors bound to members and to callables sharing the inline storage.
+ * Callables that cannot be stored are not converted to a functor.
+ **/
+void testFunctorBinding() {
+    Adder adder = { 10 };
+    int offset = 3;
+    int *p = &offset;
+    auto small = [p](int value) { return value + *p; };
+    auto large = [p, offset](int value) { return value + *p + offset; };
+    auto wrong = [p](const std::string &) { return *p; };
+
+    static_assert(std::is_convertible<decltype(small), IntFunctor>::value, "small lambda");
+    static_assert(!std::is_convertible<decltype(large), IntFunctor>::value, "large lambda");
+    static_assert(!std::is_convertible<decltype(wrong), IntFunctor>::value, "wrong parameter");
+
+    IntFunctor member = IntFunctor::from<Adder, &Adder::add>(&adder);
+    IntFunctor lambda(small);
+    IntFunctor function(&twice);
+
+    check(member(1) == 11);
+    check(lambda(1) == 4);
+    check(function(4) == 8);
+    check(member.isHost(&adder) && (member.host() == &adder));
+    check(!(member == lambda) && !(lambda == function));
+    check(lambda == IntFunctor(small));
+    check(lambda.hash() == IntFunctor(small).hash());
+    check(!IntFunctor() && (IntFunctor() == IntFunctor()));
+}
+/*}}}*/
+
+/* ------------------------------------------------------------------------ */
+/* Events                                                                   */
+/* ------------------------------------------------------------------------ */
+typedef ss::EventT<void(int)> IntEvent;
+
+/** State of a delegate that removes it self. */
+struct SelfRemover {
+    IntEvent *event;
+    IntEvent::Delegate self;
+    int calls;
+};
+
+// void testSelfRemoval();/*{{{*/
+/**
+ * A capturing lambda removing its own delegate while it runs.
+ **/
+void testSelfRemoval() {
+    IntEvent event;
+    SelfRemover state = { &event, IntEvent::Delegate(), 0 };
+    SelfRemover *p = &state;
+
+    state.self = IntEvent::Delegate([p](int) {
+        p->event->remove(p->self);
+        p->calls += 1;              /* Reads the capture after the removal. */
+    });
+    event.add(state.self);
+    event.trigger(1);
+    event.trigger(2);
+
+    check(state.calls == 1);
+    check(event.count() == 0);
+
+    typedef ss::ParallelEventT<void(int)> Parallel;
+    struct { Parallel *event; Parallel::Delegate self; int calls; } serial;
+    Parallel parallel;
+    serial.event = &parallel;
+    serial.calls = 0;
+
+    auto *q = &serial;
+    serial.self = Parallel::Delegate([q](int) {
+        q->event->remove(q->self);
+        q->calls += 1;
+    });
+    parallel.add(serial.self, ss::SerialExecution);
+    parallel.trigger(1);
+    parallel.trigger(2);
+
+    check(serial.calls == 1);
+    check(parallel.count() == 0);
+}
+/*}}}*/
+
+/** State of a delegate that adds delegates. */
+struct Grower {
+    IntEvent *event;
+    int counters[64];
+    int calls;
+};
+
+// void testAddDuringTrigger();/*{{{*/
+/**
+ * A lambda adding enough delegates to move the array to a larger buffer
+ * while it runs.
+ **/
+void testAddDuringTrigger() {
+    IntEvent event;
+    Grower state;
+    Grower *p = &state;
+
+    std::memset(&state, 0, sizeof(state));
+    state.event = &event;
+    event.add(IntEvent::Delegate([p](int) {
+        if (p->calls++) return;
+        for (int i = 0; i < 64; ++i) {
+            int *counter = &p->counters[i];
+            p->event->add(IntEvent::Delegate([counter](int value) { *counter += value; }));
+        }
+        p->calls += 100;            /* Reads the capture after the growth. */
+    }));
+    event.trigger(1);
+
+    check(state.calls == 101);
+    check(event.count() == 65);
+    for (int i = 0; i < 64; ++i) check(state.counters[i] == 1);
+
+    event.trigger(2);
+    check(state.calls == 102);
+    for (int i = 0; i < 64; ++i) check(state.counters[i] == 3);
+}
+/*}}}*/
+
+/** Delegate target of the concurrent event test. */
+struct Counter {
+    std::atomic<long> calls;
+    void hit(int value) { calls += value; std::this_thread::yield(); }
+};
+
+// void testConcurrentReclaim();/*{{{*/
+/**
+ * Readers triggering without a pause while a writer changes the list. There
+ * is almost always a trigger running, yet the replaced lists must be
+ * released while the readers are still running.
+ **/
+void testConcurrentReclaim() {
+    typedef ss::ConcurrentEventT<void(int)> Event;
+    Counter counter, other;
+    counter.calls = 0;
+    other.calls = 0;
+    {
+        Event event;
+        std::atomic<bool> stop(false);
+        std::vector<std::thread> readers;
+
+        event.bind<Counter, &Counter::hit>(&counter);
+        for (int i = 0; i < 4; ++i) {
+            readers.push_back(std::thread([&event, &stop]() {
+                while (!stop.load(std::memory_order_relaxed)) event.trigger(1);
+            }));
+        }
+
+        long before = g_allocations.load(), peak = 0;
+        for (int i = 0; i < 20000; ++i) {
+            event.add<Counter, &Counter::hit>(&other);
+            event.remove<Counter, &Counter::hit>(&other);
+            long live = g_allocations.load() - before;
+            if (live > peak) peak = live;
+        }
+        stop = true;
+        for (size_t i = 0; i < readers.size(); ++i) readers[i].join();
+
+        check(peak < 1000);
+        check(event.count() == 1);
+    }
+    check(counter.calls.load() > 0);
+}
+/*}}}*/
+
+// void testConcurrentUnchanged();/*{{{*/
+/**
+ * Changes of a concurrent event that match nothing don't allocate a new
+ * list. The ones that match still publish it.
+ **/
+void testConcurrentUnchanged() {
+    typedef ss::ConcurrentEventT<void(int)> Event;
+    Counter counter, other;
+    Event event;
+
+    event.bind<Counter, &Counter::hit>(&counter);
+    long before = g_news.load();
+    event.remove<Counter, &Counter::hit>(&other);
+    event.unbound(&other);
+    event.add<Counter, &Counter::hit>(&counter);
+    check(g_news.load() == before);
+    check(event.count() == 1);
+
+    event.add<Counter, &Counter::hit>(&other);
+    check(event.count() == 2);
+    event.unbound(&counter);
+    check(event.count() == 1);
+    event.remove<Counter, &Counter::hit>(&other);
+    check(event.count() == 0);
+}
+/*}}}*/
+
+/** State of the parallel delegates of the throwing trigger test. */
+struct SlowWorker {
+    std::atomic<long> sum;
+    void work(const std::string &value) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        sum += (long)value.size();
+    }
+    void fail(const std::string &value) {
+        work(value);
+        throw 2;
+    }
+};
+
+// void testParallelThrow();/*{{{*/
+/**
+ * A serial delegate throwing while the pool still runs parallel delegates
+ * with the arguments of the trigger.
+ **/
+void testParallelThrow() {
+    typedef ss::ParallelEventT<void(const std::string&)> Parallel;
+    ss::ThreadPool pool(2);
+    Parallel event(&pool);
+    SlowWorker workers[16];
+
+    for (int i = 0; i < 16; ++i) {
+        workers[i].sum = 0;
+        event.bind<SlowWorker, &SlowWorker::work>(&workers[i]);
+    }
+    event.add(Parallel::Delegate([](const std::string &) { throw 1; }), ss::SerialExecution);
+
+    bool thrown = false;
+    try {
+        event.trigger_parallel(std::string("four"));
+    } catch (int) {
+        thrown = true;
+    }
+    check(thrown);
+    for (int i = 0; i < 16; ++i) check(workers[i].sum.load() == 4);
+}
+/*}}}*/
+
+// void testParallelDelegateThrow();/*{{{*/
+/**
+ * Parallel delegates throwing in the pool. The exception must reach the
+ * caller of the trigger after all delegates ran.
+ **/
+void testParallelDelegateThrow() {
+    typedef ss::ParallelEventT<void(const std::string&)> Parallel;
+    ss::ThreadPool pool(2);
+    Parallel event(&pool);
+    SlowWorker workers[16];
+
+    for (int i = 0; i < 16; ++i) {
+        workers[i].sum = 0;
+        if (i % 2) event.bind<SlowWorker, &SlowWorker::fail>(&workers[i]);
+        else       event.bind<SlowWorker, &SlowWorker::work>(&workers[i]);
+    }
+
+    int thrown = 0;
+    try {
+        event.trigger_parallel(std::string("four"));
+    } catch (int value) {
+        thrown = value;
+    }
+    check(thrown == 2);
+    for (int i = 0; i < 16; ++i) check(workers[i].sum.load() == 4);
+
+    Parallel::Completion done;
+    thrown = 0;
+    event.trigger_async(done, std::string("four"));
+    try {
+        done.wait();
+    } catch (int value) {
+        thrown = value;
+    }
+    check(thrown == 2);
+    done.wait();                    /* The exception is taken once. */
+    for (int i = 0; i < 16; ++i) check(workers[i].sum.load() == 8);
+}
+/*}}}*/
+
+/** Argument whose copy can throw. */
+struct Fragile {
+    static bool fail;
+    int value;
+
+    Fragile(int v) : value(v) { }
+    Fragile(const Fragile &other) : value(other.value) { if (fail) throw 1; }
+};
+bool Fragile::fail = false;
+
+typedef ss::EventT<void(const Fragile&)> FragileEvent;
+typedef ss::EventQueueT<void(const Fragile&)> FragileQueue;
+
+/** State of the delegate of the queue test. */
+struct Consumer {
+    FragileQueue *queue;
+    int sum, nested;
+};
+
+// void testQueueThrow();/*{{{*/
+/**
+ * A post whose argument copy throws, followed by a delegate calling drain()
+ * again.
+ **/
+void testQueueThrow() {
+    FragileEvent event;
+    FragileQueue queue(&event, 4);
+    Consumer state = { &queue, 0, 0 };
+    Consumer *p = &state;
+
+    event.add(FragileEvent::Delegate([p](const Fragile &f) {
+        p->sum += f.value;
+        p->nested += (int)p->queue->drain();
+    }));
+
+    Fragile one(1), two(2), four(4);
+    check(queue.post(one));
+    Fragile::fail = true;
+    bool thrown = false;
+    try { queue.post(two); } catch (int) { thrown = true; }
+    Fragile::fail = false;
+    check(thrown);
+    check(queue.post(four));
+
+    check(queue.drain() == 2);
+    check(state.sum == 5);
+    check(state.nested == 0);
+    check(queue.pending() == 0);
+}
+/*}}}*/
+
+/** Records the order of the notifications of the batch test. */
+struct Recorder {
+    std::vector<int> values;
+    void record(int value) { values.push_back(value); }
+};
+
+/** Delegate target recording a fixed value. */
+struct Tag {
+    Recorder *recorder;
+    int value;
+    void fire(int) { recorder->record(value); }
+};
+
+// void testBatchMany();/*{{{*/
+/**
+ * A batch holding many events, each triggered twice. Each event must be
+ * delivered once, with the last arguments, in the order first held.
+ **/
+void testBatchMany() {
+    const int count = 300;
+    std::vector<IntEvent> events(count);
+    Recorder recorder;
+
+    for (int i = 0; i < count; ++i)
+        events[i].bind<Recorder, &Recorder::record>(&recorder);
+    {
+        ss::PropertyBatch batch;
+        for (int i = 0; i < count; ++i)
+            ss::PropertyBatch::trigger(&events[i], -i);
+        for (int i = count; i-- > 0; )
+            ss::PropertyBatch::trigger(&events[i], i);
+        check(batch.pending() == (size_t)count);
+        check(batch.find(&events[count - 1]) != NULL);
+        check(batch.find(&recorder) == NULL);
+    }
+
+    check(recorder.values.size() == (size_t)count);
+    for (int i = 0; i < count && i < (int)recorder.values.size(); ++i)
+        check(recorder.values[i] == i);
+}
+/*}}}*/
+
+/* ------------------------------------------------------------------------ */
+/* Properties                                                               */
+/* ------------------------------------------------------------------------ */
+/** Holder of properties of each class. */
+struct Accessors {
+    rw::PropertyT<int, int> whole;
+    ss::PropertyT<double> real;
+    ro::PropertyT<double> ratio;
+    int m_whole;
+    double m_real;
+
+    Accessors() : m_whole(1), m_real(2.5) {
+        ssplink(whole, this, Accessors, getWhole, setWhole);
+        ssplink(real, this, Accessors, getReal, setReal);
+        ratio.bind<Accessors, &Accessors::getRatio>(this);
+    }
+
+    int getWhole() const { return m_whole; }
+    void setWhole(int value) { m_whole = value; }
+    double getReal() const { return m_real; }
+    void setReal(double value) { m_real = value; }
+    double getRatio() const { return 0.5; }
+};
+
+// void testMixedOperators();/*{{{*/
+/**
+ * Result types of operators mixing property classes. The result has the
+ * type of the left value, unless only the left is a `rw::PropertyT`.
+ **/
+void testMixedOperators() {
+    Accessors a;
+    ss::PropertyT<double> &s = a.real;
+
+    check((a.whole + s) == 3.5);
+    check((s + a.whole) == 3.5);
+    check((a.whole * s) == 2.5);
+    check((a.whole + a.ratio) == 1.5);
+    check((a.ratio + a.whole) == 1.5);
+    check((s - a.ratio) == 2.0);
+    check((a.whole + a.whole) == 2);
+
+    static_assert(std::is_same<decltype(a.whole + s), double>::value, "rw + ss");
+    static_assert(std::is_same<decltype(a.whole / a.ratio), double>::value, "rw / ro");
+    static_assert(std::is_same<decltype(a.ratio - a.whole), double>::value, "ro - rw");
+}
+/*}}}*/
+
+/** Holder of a property whose setter clamps the value. */
+struct Clamped {
+    ss::PropertyT<int> value;
+    int m_value;
+
+    Clamped() : m_value(8) { ssplink(value, this, Clamped, getValue, setValue); }
+
+    int getValue() const { return m_value; }
+    void setValue(int v) { m_value = (v > 10) ? 10 : v; }
+};
+
+// void testCompoundClamped();/*{{{*/
+/**
+ * Compound assignment returns the value the property holds after the
+ * setter, not the value computed before it.
+ **/
+void testCompoundClamped() {
+    Clamped c;
+    int x = (c.value += 5);
+
+    check(x == 10);
+    check(c.m_value == 10);
+    check((c.value -= 3) == 7);
+    check((c.value *= 4) == 10);
+}
+/*}}}*/
+
+// void testReflectConst();/*{{{*/
+/**
+ * A property table reads a `const` object through its `const` getters and
+ * writes the values back to another object.
+ **/
+void testReflectConst() {
+    const auto fields = ss::reflect(ssfield(whole, Accessors, getWhole, setWhole),
+                                    ssfield(real, Accessors, getReal, setReal));
+    typedef decltype(fields)::record_t Record;
+
+    const Accessors source;
+    Accessors target;
+    Record record;
+    int calls = 0;
+
+    fields.snapshot(source, record);
+    check(sstl::RecordGetT<0>::get(record) == 1);
+    check(sstl::RecordGetT<1>::get(record) == 2.5);
+    fields.visit(source, [&calls](const char *, double) { ++calls; });
+    check(calls == 2);
+
+    sstl::RecordGetT<0>::get(record) = 7;
+    fields.restore(target, record);
+    check((target.m_whole == 7) && (target.m_real == 2.5));
+    check(fields.find("real") == 1);
+}
+/*}}}*/
+
+/** Number whose addition can throw once. */
+struct Number {
+    static bool fail;
+    int value;
+
+    Number(int v = 0) : value(v) { }
+    Number operator +(const Number &other) const {
+        if (fail) { fail = false; throw 3; }
+        return Number(value + other.value);
+    }
+    bool operator ==(const Number &other) const { return (value == other.value); }
+};
+bool Number::fail = false;
+
+// void testComputedThrow();/*{{{*/
+/**
+ * A recompute throwing during a propagation. The values not recomputed yet
+ * must be recomputed by the next change.
+ **/
+void testComputedThrow() {
+    ss::CellT<Number> a(1), b(10), c(100);
+    ss::ComputedT<Number> s, u;
+
+    s = a + b;
+    u = a + c;
+    check(s.get().value == 11);
+    check(u.get().value == 101);
+
+    bool thrown = false;
+    Number::fail = true;
+    try { a = Number(2); } catch (int) { thrown = true; }
+    check(thrown);
+
+    a = Number(5);
+    check(s.get().value == 15);
+    check(u.get().value == 105);
+}
+/*}}}*/
+
+// void testDisconnectOrder();/*{{{*/
+/**
+ * Disconnecting many delegates of an event not indexed. The remaining ones
+ * keep their order and their connections keep working.
+ **/
+void testDisconnectOrder() {
+    const int count = 1000;
+    IntEvent event;
+    Recorder recorder;
+    std::vector<Tag> tags(count);
+    std::vector<ss::Connection> links;
+
+    for (int i = 0; i < count; ++i) {
+        tags[i].recorder = &recorder;
+        tags[i].value = i;
+        links.push_back(event.connect(IntEvent::Delegate::from<Tag, &Tag::fire>(&tags[i])));
+    }
+    for (int i = 1; i < count; i += 2) links[i].disconnect();
+
+    check(event.count() == (size_t)(count / 2));
+    event.trigger(0);
+    check(recorder.values.size() == (size_t)(count / 2));
+    for (size_t i = 0; i < recorder.values.size(); ++i)
+        check(recorder.values[i] == (int)(i * 2));
+
+    for (int i = 0; i < count; i += 2) {
+        check(links[i].connected());
+        links[i].disconnect();
+    }
+    check(event.count() == 0);
+    for (int i = 0; i < count; ++i) check(!links[i].connected());
+}
+/*}}}*/
+
+/* ------------------------------------------------------------------------ */
+/* Shared pointers                                                          */
+/* ------------------------------------------------------------------------ */
+/** Object that checks it is never used after being destroyed. */
+struct Tracked {
+    static std::atomic<int> alive;
+    int value, mirror;
+
+    Tracked(int v) : value(v), mirror(-v) { ++alive; }
+    ~Tracked() { value = mirror = 1; --alive; }
+    bool valid() const { return (value == -mirror); }
+};
+std::atomic<int> Tracked::alive(0);
+
+// void testAtomicSharedABA();/*{{{*/
+/**
+ * Readers loading while a writer stores A, B, A, B... The same pointer is
+ * installed again many times while readers are inside `load()`.
+ **/
+void testAtomicSharedABA() {
+    {
+        typedef ss::SharedT<Tracked, ss::MultiThread> shared_t;
+        shared_t a(new Tracked(1)), b(new Tracked(2));
+        ss::AtomicSharedT<Tracked> slot(a);
+        std::atomic<bool> stop(false);
+        std::atomic<long> bad(0);
+        std::vector<std::thread> readers;
+
+        for (int i = 0; i < 4; ++i) {
+            readers.push_back(std::thread([&slot, &stop, &bad]() {
+                while (!stop.load(std::memory_order_relaxed)) {
+                    shared_t value = slot.load();
+                    if (!value || !value->valid()) ++bad;
+                }
+            }));
+        }
+        for (int i = 0; i < 200000; ++i) {
+            slot.store(b);
+            slot.store(a);
+        }
+        stop = true;
+        for (size_t i = 0; i < readers.size(); ++i) readers[i].join();
+
+        check(bad.load() == 0);
+        slot.store(shared_t());
+        check(a.shares() == 1);
+        check(b.shares() == 1);
+    }
+    check(Tracked::alive.load() == 0);
+}
+/*}}}*/
+
+}   /* namespace */
+
+int main() {
+    struct { const char *name; void (*run)(); } tests[] = {
+        { "functor_binding", &testFunctorBinding },
+        { "self_removal", &testSelfRemoval },
+        { "add_during_trigger", &testAddDuringTrigger },
+        { "concurrent_reclaim", &testConcurrentReclaim },
+        { "concurrent_unchanged", &testConcurrentUnchanged },
+        { "parallel_throw", &testParallelThrow },
+        { "parallel_delegate_throw", &testParallelDelegateThrow },
+        { "queue_throw", &testQueueThrow },
+        { "batch_many", &testBatchMany },
+        { "disconnect_order", &testDisconnectOrder },
+        { "mixed_operators", &testMixedOperators },
+        { "compound_clamped", &testCompoundClamped },
+        { "reflect_const", &testReflectConst },
+        { "computed_throw", &testComputedThrow },
+        { "atomic_shared_aba", &testAtomicSharedABA },
+    };
+
+    for (size_t i = 0; i < (sizeof(tests) / sizeof(tests[0])); ++i) {
+        int before = g_failures;
+        tests[i].run();
+        printf("%s %s\n", tests[i].name, ((g_failures == before) ? "ok" : "FAILED"));
+    }
+    return (g_failures ? EXIT_FAILURE : EXIT_SUCCESS);
+}